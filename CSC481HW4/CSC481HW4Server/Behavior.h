@@ -0,0 +1,43 @@
+#pragma once
+#include <coroutine>
+#include <iostream>
+
+/*
+* Return type of a behavior: a coroutine that carries something out over many ticks (such as a jump or a fall). Between steps, a
+* behavior suspends itself with co_await EventManager::getManager()->waitFor(delay) and is resumed by the EventManager once the
+* delay has passed on its timeline, so it doesn't need to raise an event just to be called back. A behavior starts running as
+* soon as it is called and destroys itself once it finishes, so callers don't need to keep hold of anything.
+*
+* Behaviors are resumed from the thread handling events, outside of any parallel wave, so everything after a behavior's first
+* co_await runs on its own (before that, it runs as part of whatever called it).
+*/
+class Behavior
+{
+	public:
+		struct promise_type
+		{
+			Behavior get_return_object()
+			{
+				return Behavior();
+			}
+
+			std::suspend_never initial_suspend() noexcept
+			{
+				return {};
+			}
+
+			std::suspend_never final_suspend() noexcept
+			{
+				return {};
+			}
+
+			void return_void()
+			{
+			}
+
+			void unhandled_exception()
+			{
+				std::cerr << "Error while running behavior" << std::endl;
+			}
+		};
+};
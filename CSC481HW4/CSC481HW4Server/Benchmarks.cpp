@@ -0,0 +1,736 @@
+#include "Benchmarks.h"
+#include <iostream>
+#include <string>
+#include <stdlib.h>
+#include <queue>
+#include <map>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include "ClientServerConsts.h"
+#include "EventManager.h"
+#include "EventHandler.h"
+#include "RealTimeline.h"
+#include "TimingWheel.h"
+#include "SteadyClockSource.h"
+#include "CoarseClockSource.h"
+#include "TscClockSource.h"
+#include "TestClockSource.h"
+#include "SparseSet.h"
+#include "TickScheduler.h"
+#include "TimelineGraph.h"
+#include "GameTimeline.h"
+#include "PropertyRegistry.h"
+#include "LocationInSpace.h"
+#include "RepeatedMovement.h"
+#include "Transform.h"
+#include "VirtualTimeline.h"
+#include "Collision.h"
+#include "Gravity.h"
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+	/*
+	* Handler used by the soak benchmark. Every few events it raises a follow-up event to be handled on a later tick, which
+	* mimics how still jumping/falling events keep events alive across ticks.
+	*/
+	class SoakHandler : public EventHandler
+	{
+		private:
+			/* number of events handled so far */
+			unsigned long long eventsHandled;
+
+		public:
+			SoakHandler(PropertyRegistry* propertyRegistry) : EventHandler(propertyRegistry, false)
+			{
+				eventsHandled = 0;
+			}
+
+			void onEvent(Event* e)
+			{
+				eventsHandled++;
+
+				if (e->getType() == ClientServerConsts::CHARACTER_MOVED_EVENT && eventsHandled % 4 == 0)
+				{
+					EventSchemas::CharacterStateChange stillFalling = { e->getPayload<EventSchemas::Movement>().objectId };
+					Event* followUpEvent = EventManager::getManager()->createEvent(EventManager::getManager()->getCurrentTime() + 50.f,
+						ClientServerConsts::CHARACTER_STILL_FALLING_EVENT, stillFalling);
+					EventManager::getManager()->raise(followUpEvent);
+				}
+			}
+
+			unsigned long long getEventsHandled()
+			{
+				return eventsHandled;
+			}
+	};
+
+	/*
+	* Comparator ordering events by timestamp, as the EventManager's queue did before it used a TimingWheel.
+	*/
+	class CompareTimestamps
+	{
+		public:
+			bool operator() (Event* a, Event* b)
+			{
+				return a->getTimestamp() > b->getTimestamp();
+			}
+	};
+
+	/*
+	* Returns a timestamp for an event raised at the given time, in the same mix the game raises them.
+	*/
+	float nextTimestamp(std::mt19937& random, float time)
+	{
+		int kind = random() % 10;
+		if (kind < 6)
+		{
+			return time + (float)(random() % 16);
+		}
+		else if (kind < 9)
+		{
+			return time + 100.f;
+		}
+
+		return time - 1000.f;
+	}
+
+	/*
+	* Runs the event queue workload on a TimingWheel or a priority queue (through the given push/pop functions) and returns the
+	* average nanoseconds per operation.
+	*/
+	template <typename Push, typename PopReady>
+	double timeEventQueue(std::vector<Event*>& events, int ticks, Push push, PopReady popReady)
+	{
+		std::mt19937 random(481);
+		int eventsNum = events.size();
+		for (int i = 0; i < eventsNum; i++)
+		{
+			events[i]->setTimestamp((float)(random() % 1100));
+			push(events[i]);
+		}
+
+		unsigned long long operations = 0;
+		std::vector<Event*> popped;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+		for (int tick = 0; tick < ticks; tick++)
+		{
+			float time = (float)tick;
+			Event* e;
+			while (popReady(time, e))
+			{
+				popped.push_back(e);
+			}
+
+			int poppedNum = popped.size();
+			for (int i = 0; i < poppedNum; i++)
+			{
+				popped[i]->setTimestamp(nextTimestamp(random, time));
+				push(popped[i]);
+			}
+			operations += 2 * poppedNum;
+			popped.clear();
+		}
+
+		double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		return operations > 0 ? elapsed / operations : 0.0;
+	}
+
+	/*
+	* Gravity as it was stored before its fields moved into a SparseSet and arrays: a list of ids plus one std::map per field,
+	* each looked up by id every time the object is touched. Processing is the same as Gravity's, so only the storage differs.
+	*/
+	class MapGravity
+	{
+		private:
+			PropertyRegistry* propertyRegistry;
+			Timeline* timeline;
+			std::vector<int> objects;
+			std::map<int, int> locationsInSpace;
+			std::map<int, int> collisions;
+			std::map<int, bool> jumpingUpValues;
+			std::map<int, bool> fallingDownValues;
+			std::map<int, bool> standingOnObjectsValues;
+			std::map<int, std::vector<int>> collisionsToCheck;
+			std::map<int, int> objectsStoodOn;
+			std::map<int, float> velocities;
+			std::map<int, float> readyTimes;
+
+		public:
+			MapGravity(PropertyRegistry* propertyRegistry, Timeline* timeline)
+			{
+				this->propertyRegistry = propertyRegistry;
+				this->timeline = timeline;
+			}
+
+			void addObject(int objectId, int locationInSpaceId, int collisionId, std::vector<int> collisionsToCheck,
+				int objectStandingOn, float velocity)
+			{
+				if (velocities.count(objectId) > 0)
+				{
+					std::cerr << "Cannot add duplicate to MapGravity" << std::endl;
+					return;
+				}
+
+				objects.push_back(objectId);
+				locationsInSpace.insert(std::pair<int, int>(objectId, locationInSpaceId));
+				collisions.insert(std::pair<int, int>(objectId, collisionId));
+				this->collisionsToCheck.insert(std::pair<int, std::vector<int>>(objectId, collisionsToCheck));
+				objectsStoodOn.insert(std::pair<int, int>(objectId, objectStandingOn));
+				velocities.insert(std::pair<int, float>(objectId, velocity));
+				readyTimes.insert(std::pair<int, float>(objectId, 0.f));
+				jumpingUpValues.insert(std::pair<int, bool>(objectId, false));
+				fallingDownValues.insert(std::pair<int, bool>(objectId, false));
+				standingOnObjectsValues.insert(std::pair<int, bool>(objectId, true));
+			}
+
+			void setJumpingUp(int objectId, bool jumpingUp)
+			{
+				jumpingUpValues[objectId] = jumpingUp;
+			}
+
+			void processGravity(int objectId)
+			{
+				if (timeline->isPaused() || jumpingUpValues.at(objectId))
+				{
+					return;
+				}
+
+				LocationInSpace* locationInSpace = propertyRegistry->get<LocationInSpace>(locationsInSpace.at(objectId));
+				Transform* objectTransform = locationInSpace->getObjectTransform(objectId);
+				Collision* objectCollision = propertyRegistry->get<Collision>(collisions.at(objectId));
+				objectTransform->setPosition(objectTransform->getX(), objectTransform->getY() + 1.f);
+
+				bool falling = true;
+				const std::vector<int>& collisionsBeingChecked = collisionsToCheck.at(objectId);
+				int collisionsNum = collisionsBeingChecked.size();
+				for (int i = 0; i < collisionsNum; i++)
+				{
+					Collision* collisionChecking = propertyRegistry->get<Collision>(collisionsBeingChecked[i]);
+					const std::vector<int>& currentObjects = collisionChecking->getObjects();
+					int objectsNum = currentObjects.size();
+					for (int j = 0; j < objectsNum; j++)
+					{
+						if (objectCollision->isCollidingWith(objectId, currentObjects[j], collisionsBeingChecked[i]))
+						{
+							falling = false;
+							standingOnObjectsValues[objectId] = true;
+							objectsStoodOn[objectId] = currentObjects[j];
+							fallingDownValues[objectId] = false;
+							break;
+						}
+					}
+				}
+
+				if (falling)
+				{
+					standingOnObjectsValues[objectId] = false;
+					fallingDownValues[objectId] = true;
+					readyTimes[objectId] = timeline->getTime() + velocities.at(objectId);
+				}
+				else
+				{
+					objectTransform->setPosition(objectTransform->getX(), objectTransform->getY() - 1.f);
+				}
+			}
+
+			void processGravityForAll()
+			{
+				int objectsNum = objects.size();
+				for (int i = 0; i < objectsNum; i++)
+				{
+					processGravity(objects[i]);
+				}
+			}
+	};
+}
+
+int Benchmarks::run(int argc, char* argv[])
+{
+	std::string benchmarkName = argv[1];
+
+	if (benchmarkName == "event-pool-soak")
+	{
+		int ticks = argc > 2 ? atoi(argv[2]) : 100000;
+		int eventsPerTick = argc > 3 ? atoi(argv[3]) : 64;
+		return runEventPoolSoak(ticks, eventsPerTick);
+	}
+	else if (benchmarkName == "event-queue")
+	{
+		int ticks = argc > 2 ? atoi(argv[2]) : 1000;
+		int pendingNums[] = { 10000, 100000, 1000000 };
+		for (int i = 0; i < 3; i++)
+		{
+			runEventQueueComparison(pendingNums[i], ticks);
+		}
+		return 0;
+	}
+	else if (benchmarkName == "clock-sources")
+	{
+		int reads = argc > 2 ? atoi(argv[2]) : 10000000;
+		return runClockSourceComparison(reads);
+	}
+	else if (benchmarkName == "property-storage")
+	{
+		int passes = argc > 2 ? atoi(argv[2]) : 1000;
+		int objectsNums[] = { 100, 1000, 10000 };
+		for (int i = 0; i < 3; i++)
+		{
+			runPropertyStorageComparison(objectsNums[i], passes);
+		}
+		return 0;
+	}
+	else if (benchmarkName == "fixed-step")
+	{
+		return runFixedStepCatchUp();
+	}
+	else if (benchmarkName == "membership")
+	{
+		int objectsNums[] = { 10, 100, 1000, 10000 };
+		for (int i = 0; i < 4; i++)
+		{
+			runMembershipComparison(objectsNums[i]);
+		}
+		return 0;
+	}
+
+	std::cerr << "No such benchmark: " + benchmarkName << std::endl;
+	std::cerr << "Available benchmarks:" << std::endl;
+	std::cerr << "  event-pool-soak [ticks] [eventsPerTick]" << std::endl;
+	std::cerr << "  event-queue [ticks]" << std::endl;
+	std::cerr << "  clock-sources [reads]" << std::endl;
+	std::cerr << "  property-storage [passes]" << std::endl;
+	std::cerr << "  membership" << std::endl;
+	std::cerr << "  fixed-step" << std::endl;
+	return 1;
+}
+
+int Benchmarks::runEventPoolSoak(int ticks, int eventsPerTick)
+{
+	PropertyRegistry propertyRegistry;
+	EventManager* eventManager = EventManager::getManager();
+	RealTimeline* msTimeline = new RealTimeline(0.001f);
+	eventManager->setTimeline(msTimeline);
+	eventManager->setEventTypes({
+		{ ClientServerConsts::CHARACTER_MOVED_EVENT, ClientServerConsts::CHARACTER_MOVED_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_STILL_FALLING_EVENT, ClientServerConsts::CHARACTER_STILL_FALLING_EVENT_NAME } });
+
+	SoakHandler* soakHandler = new SoakHandler(&propertyRegistry);
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_EVENT, soakHandler);
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_STILL_FALLING_EVENT, soakHandler);
+
+	//report progress ten times over the run
+	int reportInterval = ticks >= 10 ? ticks / 10 : 1;
+	unsigned long long allocatedAtLastReport = 0;
+
+	for (int tick = 1; tick <= ticks; tick++)
+	{
+		for (int i = 0; i < eventsPerTick; i++)
+		{
+			EventSchemas::Movement movement = { i, 0, 1.f, 0.f, 0.f, 0.f };
+			Event* movedEvent = eventManager->createEvent(eventManager->getCurrentTime(), ClientServerConsts::CHARACTER_MOVED_EVENT,
+				movement);
+			eventManager->raise(movedEvent);
+		}
+
+		eventManager->handleEvents();
+
+		if (tick % reportInterval == 0)
+		{
+			unsigned long long allocated = eventManager->getEventsAllocated();
+			std::cout << "tick " + std::to_string(tick)
+				+ ": allocations/tick " + std::to_string((double)(allocated - allocatedAtLastReport) / reportInterval)
+				+ ", events in use " + std::to_string(eventManager->getEventsInUse())
+				+ ", pool size " + std::to_string(allocated)
+				+ ", peak RSS " + std::to_string(getPeakMemoryKb()) + " KB" << std::endl;
+			allocatedAtLastReport = allocated;
+		}
+	}
+
+	std::cout << "events handled: " + std::to_string(soakHandler->getEventsHandled()) << std::endl;
+	std::cout << "total allocations/tick: " + std::to_string((double)eventManager->getEventsAllocated() / ticks) << std::endl;
+	std::cout << "peak RSS: " + std::to_string(getPeakMemoryKb()) + " KB" << std::endl;
+
+	return 0;
+}
+
+int Benchmarks::runEventQueueComparison(int pendingNum, int ticks)
+{
+	std::vector<Event*> events;
+	for (int i = 0; i < pendingNum; i++)
+	{
+		EventSchemas::Movement movement = { i, 0, 0.f, 0.f, 0.f, 0.f };
+		events.push_back(new Event(0.f, ClientServerConsts::CHARACTER_MOVED_EVENT, &movement, sizeof(movement)));
+	}
+
+	std::priority_queue<Event*, std::vector<Event*>, CompareTimestamps> priorityQueue;
+	double priorityQueueNs = timeEventQueue(events, ticks,
+		[&](Event* e) { priorityQueue.push(e); },
+		[&](float time, Event*& e)
+		{
+			if (priorityQueue.empty() || priorityQueue.top()->getTimestamp() > time)
+			{
+				return false;
+			}
+			e = priorityQueue.top();
+			priorityQueue.pop();
+			return true;
+		});
+
+	TimingWheel<Event*> timingWheel(1.f, 2048);
+	double timingWheelNs = timeEventQueue(events, ticks,
+		[&](Event* e) { timingWheel.push(e->getTimestamp(), e); },
+		[&](float time, Event*& e) { return timingWheel.popReady(time, e); });
+
+	std::cout << std::to_string(pendingNum) + " pending: priority_queue " + std::to_string(priorityQueueNs)
+		+ " ns/op, TimingWheel " + std::to_string(timingWheelNs) + " ns/op" << std::endl;
+
+	for (int i = 0; i < pendingNum; i++)
+	{
+		delete(events[i]);
+	}
+
+	return 0;
+}
+
+int Benchmarks::runClockSourceComparison(int reads)
+{
+	ClockSource* previousClockSource = Timeline::getClockSource();
+	ClockSource* clockSources[] = { new SteadyClockSource(), new CoarseClockSource(), new TscClockSource() };
+
+	for (int i = 0; i < 3; i++)
+	{
+		ClockSource* clockSource = clockSources[i];
+
+		//time raw reads, keeping track of the smallest step the clock takes between them
+		long long smallestStep = 0;
+		long long lastTicks = clockSource->readTicks();
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (int read = 0; read < reads; read++)
+		{
+			long long ticks = clockSource->readTicks();
+			if (ticks != lastTicks && (smallestStep == 0 || ticks - lastTicks < smallestStep))
+			{
+				smallestStep = ticks - lastTicks;
+			}
+			lastTicks = ticks;
+		}
+		double readNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / reads;
+
+		//time reads through a millisecond timeline (summed so they aren't optimized away)
+		Timeline::setClockSource(clockSource);
+		RealTimeline* msTimeline = new RealTimeline(0.001f);
+		float timeSum = 0.f;
+		start = std::chrono::steady_clock::now();
+		for (int read = 0; read < reads; read++)
+		{
+			timeSum += msTimeline->getTime();
+		}
+		double timelineReadNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / reads;
+		delete(msTimeline);
+
+		std::cout << std::string(clockSource->getName()) + ": " + std::to_string(clockSource->getTicksPerSecond()) + " ticks/s, read "
+			+ std::to_string(readNs) + " ns, timeline read " + std::to_string(timelineReadNs) + " ns, smallest step "
+			+ std::to_string(smallestStep * 1e9 / clockSource->getTicksPerSecond()) + " ns"
+			+ (timeSum < 0.f ? " (timeline paused)" : "") << std::endl;
+	}
+
+	//show how a millisecond timeline's float time loses resolution as uptime grows, while the ticks underneath don't
+	TestClockSource* testClockSource = new TestClockSource(1000000000LL);
+	Timeline::setClockSource(testClockSource);
+	double uptimeSeconds[] = { 60.0, 3600.0, 4 * 3600.0, 24 * 3600.0, 7 * 24 * 3600.0 };
+	for (int i = 0; i < 5; i++)
+	{
+		testClockSource->setTicks(0);
+		RealTimeline* msTimeline = new RealTimeline(0.001f);
+
+		testClockSource->setTicks((long long)(uptimeSeconds[i] * 1e9));
+		float before = msTimeline->getTime();
+		testClockSource->advance(1000000LL);
+		float after = msTimeline->getTime();
+		delete(msTimeline);
+
+		std::cout << "after " + std::to_string(uptimeSeconds[i] / 3600.0) + " h: float ms resolution "
+			+ std::to_string(nextafterf(before, INFINITY) - before) + " ms, 1 ms step reads as " + std::to_string(after - before)
+			+ " ms, tick resolution " + std::to_string(1000.0 / testClockSource->getTicksPerSecond()) + " ms" << std::endl;
+	}
+
+	Timeline::setClockSource(previousClockSource);
+	delete(testClockSource);
+	for (int i = 0; i < 3; i++)
+	{
+		delete(clockSources[i]);
+	}
+
+	return 0;
+}
+
+int Benchmarks::runPropertyStorageComparison(int objectsNum, int passes)
+{
+	//characters standing on a floor, a fifth of them mid-jump, as in the game's scene
+	PropertyRegistry propertyRegistry;
+	VirtualTimeline* gravityTimeline = new VirtualTimeline(0.001f);
+	LocationInSpace* locationInSpace = new LocationInSpace(0, &propertyRegistry);
+	Collision* characterCollision = new Collision(1, &propertyRegistry);
+	Collision* platformCollision = new Collision(2, &propertyRegistry);
+	Gravity* gravity = new Gravity(3, &propertyRegistry, gravityTimeline);
+	propertyRegistry.add(locationInSpace);
+	propertyRegistry.add(characterCollision);
+	propertyRegistry.add(platformCollision);
+	propertyRegistry.add(gravity);
+	MapGravity mapGravity(&propertyRegistry, gravityTimeline);
+
+	const int FLOOR_ID = 4;
+	std::vector<Transform*> transforms;
+	transforms.push_back(new Transform(0.f, 500.f, objectsNum * 20.f, 20.f, 0));
+	locationInSpace->addObject(FLOOR_ID, transforms.back());
+	platformCollision->addObject(FLOOR_ID, locationInSpace->getId());
+
+	//object ids are spread out as they are in the game, where every object and property draws from the same id counter
+	std::vector<int> objects;
+	for (int i = 0; i < objectsNum; i++)
+	{
+		int objectId = FLOOR_ID + 1 + i * 7;
+		objects.push_back(objectId);
+		transforms.push_back(new Transform(i * 20.f, 490.f, 10.f, 10.f, 0));
+		locationInSpace->addObject(objectId, transforms.back());
+		characterCollision->addObject(objectId, locationInSpace->getId());
+	}
+
+	//time adding every object to each
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int i = 0; i < objectsNum; i++)
+	{
+		mapGravity.addObject(objects[i], locationInSpace->getId(), characterCollision->getId(), { platformCollision->getId() },
+			FLOOR_ID, 10.f);
+	}
+	double mapAddNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / objectsNum;
+
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < objectsNum; i++)
+	{
+		gravity->addObject(objects[i], locationInSpace->getId(), characterCollision->getId(), { platformCollision->getId() },
+			FLOOR_ID, 10.f);
+	}
+	double arraysAddNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / objectsNum;
+
+	for (int i = 0; i < objectsNum; i += 5)
+	{
+		mapGravity.setJumpingUp(objects[i], true);
+		gravity->setJumpingUp(objects[i], true);
+	}
+
+	//time processing gravity for every object each tick, as the gravity handler does
+	start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < passes; pass++)
+	{
+		gravityTimeline->advance(1.f / 60.f);
+		mapGravity.processGravityForAll();
+	}
+	double mapTickNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count()
+		/ ((double)objectsNum * passes);
+
+	start = std::chrono::steady_clock::now();
+	for (int pass = 0; pass < passes; pass++)
+	{
+		gravityTimeline->advance(1.f / 60.f);
+		gravity->processGravityForAll();
+	}
+	double arraysTickNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count()
+		/ ((double)objectsNum * passes);
+
+	std::cout << std::to_string(objectsNum) + " objects: add std::map fields " + std::to_string(mapAddNs) + " ns, Gravity "
+		+ std::to_string(arraysAddNs) + " ns; tick std::map fields " + std::to_string(mapTickNs) + " ns/object, Gravity "
+		+ std::to_string(arraysTickNs) + " ns/object (" + std::to_string(arraysTickNs > 0.0 ? mapTickNs / arraysTickNs : 0.0)
+		+ "x)" << std::endl;
+
+	propertyRegistry.deleteAll();
+	int transformsNum = transforms.size();
+	for (int i = 0; i < transformsNum; i++)
+	{
+		delete(transforms[i]);
+	}
+	delete(gravityTimeline);
+
+	return 0;
+}
+
+int Benchmarks::runMembershipComparison(int objectsNum)
+{
+	std::vector<int> objectList;
+	SparseSet objectSet;
+	for (int i = 0; i < objectsNum; i++)
+	{
+		objectList.push_back(i * 7);
+		objectSet.insert(i * 7);
+	}
+
+	//check every object, in a shuffled order so the scan isn't always finding early objects
+	std::vector<int> checks = objectList;
+	std::mt19937 random(481);
+	std::shuffle(checks.begin(), checks.end(), random);
+	int checkRounds = 1000000 / objectsNum > 0 ? 1000000 / objectsNum : 1;
+
+	unsigned long long found = 0;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int round = 0; round < checkRounds; round++)
+	{
+		for (int i = 0; i < objectsNum; i++)
+		{
+			int listNum = objectList.size();
+			for (int j = 0; j < listNum; j++)
+			{
+				if (objectList[j] == checks[i])
+				{
+					found++;
+					break;
+				}
+			}
+		}
+	}
+	double scanNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count()
+		/ ((double)checkRounds * objectsNum);
+
+	start = std::chrono::steady_clock::now();
+	for (int round = 0; round < checkRounds; round++)
+	{
+		for (int i = 0; i < objectsNum; i++)
+		{
+			if (objectSet.contains(checks[i]))
+			{
+				found++;
+			}
+		}
+	}
+	double setNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count()
+		/ ((double)checkRounds * objectsNum);
+
+	//remove every object (in the shuffled order) and put it back at the end, as a disconnect and reconnect would
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < objectsNum; i++)
+	{
+		int listNum = objectList.size();
+		for (int j = 0; j < listNum; j++)
+		{
+			if (objectList[j] == checks[i])
+			{
+				objectList.erase(objectList.begin() + j);
+				break;
+			}
+		}
+		objectList.push_back(checks[i]);
+	}
+	double eraseNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / objectsNum;
+
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < objectsNum; i++)
+	{
+		objectSet.remove(checks[i]);
+		objectSet.insert(checks[i]);
+	}
+	double swapRemoveNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / objectsNum;
+
+	std::cout << std::to_string(objectsNum) + " objects: hasObject scan " + std::to_string(scanNs) + " ns, SparseSet "
+		+ std::to_string(setNs) + " ns; remove erase " + std::to_string(eraseNs) + " ns, swap-remove " + std::to_string(swapRemoveNs)
+		+ " ns" + (found == 0 ? " (nothing found)" : "") << std::endl;
+
+	return 0;
+}
+
+int Benchmarks::runFixedStepCatchUp()
+{
+	const float TICKS_PER_SECOND = 60.f;
+	const float VELOCITY = 0.1f;
+	const int TICKS_BEHIND = 3;
+
+	ClockSource* previousClockSource = Timeline::getClockSource();
+	TestClockSource* testClockSource = new TestClockSource(1000000000LL);
+	Timeline::setClockSource(testClockSource);
+
+	//a platform moving right along a long route on a millisecond timeline, as the moving platforms do
+	PropertyRegistry propertyRegistry;
+	RealTimeline* msTimeline = new RealTimeline(0.001f);
+	GameTimeline* platformTimeline = new GameTimeline(1.f, msTimeline);
+	LocationInSpace* locationInSpace = new LocationInSpace(0, &propertyRegistry);
+	RepeatedMovement* repeatedMovement = new RepeatedMovement(1, &propertyRegistry, platformTimeline);
+	propertyRegistry.add(locationInSpace);
+	propertyRegistry.add(repeatedMovement);
+	Transform* transform = new Transform(0.f, 0.f, 10.f, 10.f, 0);
+	locationInSpace->addObject(0, transform);
+	repeatedMovement->addObject(0, locationInSpace->getId(), { RepeatedMovement::RepeatedMovementPosition(0.f, 0.f, false),
+		RepeatedMovement::RepeatedMovementPosition(1000000.f, 0.f, false) }, 0.f, VELOCITY);
+
+	//first tick is due straight away, then the clock jumps ahead so that several are owed
+	TickScheduler tickScheduler(TICKS_PER_SECOND, TICKS_BEHIND + 1, testClockSource);
+	float periodMs = tickScheduler.getTickPeriod() * 1000.f;
+	float expectedStep = VELOCITY * periodMs;
+	int ticksDue = tickScheduler.waitForTicks();
+	TimelineGraph::getGraph()->beginTick(tickScheduler.getDueTickTime(0));
+	repeatedMovement->updatePosition(0);
+	TimelineGraph::getGraph()->endTick();
+	//partway through a period, so the tick count doesn't hinge on rounding at a deadline
+	testClockSource->advance(llround((TICKS_BEHIND + 0.5) * tickScheduler.getTickPeriod() * testClockSource->getTicksPerSecond()));
+	ticksDue = tickScheduler.waitForTicks();
+
+	bool passed = ticksDue == TICKS_BEHIND;
+	std::cout << std::to_string(ticksDue) + " ticks due (expected " + std::to_string(TICKS_BEHIND) + "), each should move "
+		+ std::to_string(expectedStep) + " px" << std::endl;
+	float startX = transform->getX();
+	for (int tick = 0; tick < ticksDue; tick++)
+	{
+		float previousX = transform->getX();
+		TimelineGraph::getGraph()->beginTick(tickScheduler.getDueTickTime(tick));
+		repeatedMovement->updatePosition(0);
+		TimelineGraph::getGraph()->endTick();
+
+		float step = transform->getX() - previousX;
+		bool stepPassed = fabs(step - expectedStep) < 0.001f;
+		passed = passed && stepPassed;
+		std::cout << "tick " + std::to_string(tick) + ": moved " + std::to_string(step) + " px" + (stepPassed ? "" : " (wrong)")
+			<< std::endl;
+	}
+	float moved = transform->getX() - startX;
+	passed = passed && fabs(moved - TICKS_BEHIND * expectedStep) < 0.001f;
+	std::cout << "moved " + std::to_string(moved) + " px in total (expected " + std::to_string(TICKS_BEHIND * expectedStep)
+		+ " px): " + (passed ? "passed" : "FAILED") << std::endl;
+
+	propertyRegistry.deleteAll();
+	delete(transform);
+	delete(platformTimeline);
+	delete(msTimeline);
+	Timeline::setClockSource(previousClockSource);
+	delete(testClockSource);
+
+	return passed ? 0 : 1;
+}
+
+unsigned long long Benchmarks::getPeakMemoryKb()
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		return counters.PeakWorkingSetSize / 1024;
+	}
+
+	return 0;
+#else
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) == 0)
+	{
+		//ru_maxrss is already in kilobytes on Linux
+		return usage.ru_maxrss;
+	}
+
+	return 0;
+#endif
+}
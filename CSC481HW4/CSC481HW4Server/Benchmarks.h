@@ -0,0 +1,97 @@
+#pragma once
+
+/*
+* Namespace defining benchmarks that exercise engine systems without any clients connected. A benchmark is run by passing its
+* name (and any of its options) as arguments to the server, in which case the server runs the benchmark and exits instead of
+* starting up normally.
+*/
+namespace Benchmarks
+{
+	/*
+	* Runs the benchmark named by the first argument with any remaining arguments as its options.
+	* 
+	* argc: number of arguments (including program name)
+	* argv: arguments given to the server
+	* 
+	* returns: exit code for the server
+	*/
+	int run(int argc, char* argv[]);
+
+	/*
+	* Soak test for the EventManager's event pool. Each tick raises a burst of events, some of which raise follow-up events
+	* scheduled for later ticks (as jumps and falls do), and then handles everything that is due. Reports peak resident memory
+	* and how many new events had to be allocated per tick, which should drop to zero once the pool has warmed up.
+	* 
+	* ticks: number of ticks to run
+	* eventsPerTick: number of events raised each tick
+	* 
+	* returns: exit code for the server
+	*/
+	int runEventPoolSoak(int ticks, int eventsPerTick);
+
+	/*
+	* Compares the EventManager's TimingWheel against the std::priority_queue it replaced. Keeps the given number of events pending
+	* while simulated time advances one timeline unit per tick; each tick pops every due event and reschedules it the way the game
+	* does (mostly for now, some 100 units ahead as with still jumping/falling events, and some 1000 units behind as with platform
+	* moves). Reports the average time per push and pop for each queue.
+	* 
+	* pendingNum: number of events kept pending
+	* ticks: number of ticks to simulate
+	* 
+	* returns: exit code for the server
+	*/
+	int runEventQueueComparison(int pendingNum, int ticks);
+
+	/*
+	* Compares the clock sources timelines can read real time from. For each source, reports the average cost of a raw read and of
+	* a RealTimeline read through it, and the smallest step seen between consecutive reads. Then uses a test clock to show how
+	* finely a millisecond timeline's float time can still tell readings apart after increasing amounts of uptime, against the
+	* nanosecond resolution of the integer ticks underneath.
+	* 
+	* reads: number of reads to time for each source
+	* 
+	* returns: exit code for the server
+	*/
+	int runClockSourceComparison(int reads);
+
+	/*
+	* Compares the per-object property storage Gravity used to have (a list of ids and one std::map per field, looked up by id
+	* for each object) against the real Gravity property with its SparseSet and field arrays. Characters stand on a floor, with a
+	* fifth of them mid-jump. Times adding every object and then processing gravity for all of them each tick, the way the
+	* gravity handler does. Reports the average time per addition and per object per tick for each.
+	* 
+	* objectsNum: number of objects stored
+	* passes: number of ticks to process
+	* 
+	* returns: exit code for the server
+	*/
+	int runPropertyStorageComparison(int objectsNum, int passes);
+
+	/*
+	* Compares checking and removing property membership with the linear scan of an id list that Property used to do against the
+	* SparseSet it uses now. Checks membership of every object (as nearly every property method and handler does first), then
+	* removes and re-adds objects one at a time. Reports the average time per check and per removal for each.
+	* 
+	* objectsNum: number of objects in the property
+	* 
+	* returns: exit code for the server
+	*/
+	int runMembershipComparison(int objectsNum);
+
+	/*
+	* Checks that ticks run to catch up each advance the simulation by exactly one tick period. Drives a TickScheduler and a
+	* moving platform's timeline from a test clock, lets the clock fall three tick periods behind so that three ticks are due at
+	* once, then runs each at the deadline the scheduler gives it. Reports how far the platform moved on each tick against how far
+	* it should move in one period.
+	* 
+	* returns: exit code for the server (1 if any tick moved the platform the wrong distance)
+	*/
+	int runFixedStepCatchUp();
+
+	/*
+	* Returns the peak resident memory of the process.
+	* 
+	* returns: peak resident memory in kilobytes (or 0 if unavailable)
+	*/
+	unsigned long long getPeakMemoryKb();
+}
@@ -1,49 +1,41 @@
-#include "CharacterSpawnHandler.h"
-
-CharacterSpawnHandler::CharacterSpawnHandler(std::map<int, Property*>* propertyMap, bool notifyWhileReplaying,
-	int locationInSpaceId, int respawningId)
-	: EventHandler(propertyMap, notifyWhileReplaying)
-{
-	this->locationInSpaceId = locationInSpaceId;
-	this->respawningId = respawningId;
-}
-
-void CharacterSpawnHandler::onEvent(Event* e)
-{
-	//if character has died, respawn them
-	if (e->getType() == ClientServerConsts::CHARACTER_DEATH_EVENT)
-	{
-		//get character id
-		int characterId = e->getArgument(0).argValue.argAsInt;
-
-		//get respawning and location in space
-		Respawning* respawning = (Respawning*)propertyMap->at(respawningId);
-		LocationInSpace* locationInSpace = (LocationInSpace*)propertyMap->at(locationInSpaceId);
-
-		//make sure character still exists (client could have disconnected)
-		if (respawning->hasObject(characterId) && locationInSpace->hasObject(characterId))
-		{
-			//respawn character
-			respawning->respawn(characterId);
-
-			//get character's position
-			sf::Shape* charShape = locationInSpace->getObjectShape(characterId);
-			float newX = charShape->getPosition().x;
-			float newY = charShape->getPosition().y;
-
-			//raise spawn event
-			struct Event::ArgumentVariant charIdArg = { Event::ArgumentType::TYPE_INTEGER, characterId };
-			struct Event::ArgumentVariant locationInSpaceIdArg = { Event::ArgumentType::TYPE_INTEGER, locationInSpaceId };
-			struct Event::ArgumentVariant xArg;
-			xArg.argType = Event::ArgumentType::TYPE_FLOAT;
-			xArg.argValue.argAsFloat = newX;
-			struct Event::ArgumentVariant yArg;
-			yArg.argType = Event::ArgumentType::TYPE_FLOAT;
-			yArg.argValue.argAsFloat = newY;
-			Event* characterSpawnEvent = new Event(EventManager::getManager()->getCurrentTime(),
-				ClientServerConsts::CHARACTER_SPAWN_EVENT,
-				{ charIdArg, locationInSpaceIdArg, xArg, yArg });
-			EventManager::getManager()->raise(characterSpawnEvent);
-		}
-	}
-}
+#include "CharacterSpawnHandler.h"
+
+CharacterSpawnHandler::CharacterSpawnHandler(PropertyRegistry* propertyRegistry, bool notifyWhileReplaying,
+	int locationInSpaceId, int respawningId)
+	: EventHandler(propertyRegistry, notifyWhileReplaying)
+{
+	this->locationInSpaceId = locationInSpaceId;
+	this->respawningId = respawningId;
+
+	//look up properties now rather than on every event
+	locationInSpace = propertyRegistry->get<LocationInSpace>(locationInSpaceId);
+	respawning = propertyRegistry->get<Respawning>(respawningId);
+}
+
+void CharacterSpawnHandler::onEvent(Event* e)
+{
+	//if character has died, respawn them
+	if (e->getType() == ClientServerConsts::CHARACTER_DEATH_EVENT)
+	{
+		//get character id
+		int characterId = e->getPayload<EventSchemas::CharacterStateChange>().characterId;
+
+		//make sure character still exists (client could have disconnected)
+		if (respawning->hasObject(characterId) && locationInSpace->hasObject(characterId))
+		{
+			//respawn character
+			respawning->respawn(characterId);
+
+			//get character's position
+			Transform* charTransform = locationInSpace->getObjectTransform(characterId);
+			float newX = charTransform->getX();
+			float newY = charTransform->getY();
+
+			//raise spawn event
+			EventSchemas::CharacterSpawn spawn = { characterId, locationInSpaceId, newX, newY };
+			Event* characterSpawnEvent = EventManager::getManager()->createEvent(EventManager::getManager()->getCurrentTime(),
+				ClientServerConsts::CHARACTER_SPAWN_EVENT, spawn);
+			EventManager::getManager()->raise(characterSpawnEvent);
+		}
+	}
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+/*
+* An abstract class for a monotonic clock that timelines read real time from. A clock source reports time as a 64-bit integer
+* count of ticks since some fixed point, along with how many ticks make up a second, so differences between readings stay exact
+* no matter how long the server has been up (converting to floating point only happens once a difference has been taken).
+*/
+class ClockSource
+{
+public:
+	/*
+	* Destroys the clock source.
+	*/
+	virtual ~ClockSource() {}
+
+	/*
+	* Returns the current reading of the clock.
+	*
+	* returns: number of ticks since the clock's starting point
+	*/
+	virtual long long readTicks() = 0;
+
+	/*
+	* Returns how many of the clock's ticks make up a second.
+	*
+	* returns: ticks per second
+	*/
+	virtual long long getTicksPerSecond() = 0;
+
+	/*
+	* Returns the name of the clock source (used in reporting).
+	*
+	* returns: name of clock source
+	*/
+	virtual const char* getName() = 0;
+};
@@ -0,0 +1,39 @@
+#include "CoarseClockSource.h"
+#include <chrono>
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__linux__)
+#include <time.h>
+#endif
+
+long long CoarseClockSource::readTicks()
+{
+#ifdef _WIN32
+    //milliseconds since boot, read from the shared user data page
+    return (long long)GetTickCount64();
+#elif defined(__linux__)
+    //nanoseconds, read through the vDSO without a system call
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC_COARSE, &now);
+    return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+#else
+    return (long long)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+long long CoarseClockSource::getTicksPerSecond()
+{
+#ifdef _WIN32
+    return 1000LL;
+#elif defined(__linux__)
+    return 1000000000LL;
+#else
+    return (long long)(std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num);
+#endif
+}
+
+const char* CoarseClockSource::getName()
+{
+    return "coarse";
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "ClockSource.h"
+
+/*
+* A clock source reading the operating system's coarse monotonic clock, which the kernel keeps cached in memory shared with the
+* process and only updates on each timer interrupt. Reading it is little more than a memory load, but it only moves forward in
+* steps of the timer resolution (about 15.6 ms on Windows by default, or 1 ms after timeBeginPeriod(1); a few ms on Linux), so
+* it suits code that only needs time to the nearest tick. Falls back to steady_clock where no coarse clock is available.
+*/
+class CoarseClockSource :
+	public ClockSource
+{
+public:
+	/*
+	* Returns the current reading of the coarse clock.
+	*
+	* returns: number of ticks since the clock's starting point
+	*/
+	long long readTicks();
+
+	/*
+	* Returns how many of the coarse clock's ticks make up a second (its units, not how often it updates).
+	*
+	* returns: ticks per second
+	*/
+	long long getTicksPerSecond();
+
+	/*
+	* Returns the name of the clock source.
+	*
+	* returns: name of clock source
+	*/
+	const char* getName();
+};
@@ -1,103 +1,125 @@
-#include "Collision.h"
-#include <iostream>
-#include "LocationInSpace.h"
-
-Collision::Collision(int id, std::map<int, Property*>* propertyMap) : Property(id, propertyMap)
-{
-	//construction taken care of in Property
-}
-
-void Collision::addObject(int objectId, int locationInSpaceId)
-{
-	if (hasObject(objectId))
-	{
-		std::cerr << "Cannot add duplicate object to Collision" << std::endl;
-		return;
-	}
-
-	objects.push_back(objectId);
-	locationsInSpace.insert(std::pair<int, int>(objectId, locationInSpaceId));
-}
-
-void Collision::removeObject(int objectId)
-{
-	//remove from objects list
-	int objectsNum = objects.size();
-	for (int i = 0; i < objectsNum; i++)
-	{
-		if (objects[i] == objectId)
-		{
-			objects.erase(objects.begin() + i);
-		}
-	}
-
-	//remove LocationInSpace
-	locationsInSpace.erase(objectId);
-}
-
-std::map<int, int>* Collision::getLocationsInSpace()
-{
-	return &locationsInSpace;
-}
-
-std::vector<int> Collision::getObjects()
-{
-	return objects;
-}
-
-bool Collision::isCollidingWithAny(int objectId, int collision)
-{
-	if (!hasObject(objectId))
-	{
-		std::cerr << "No such object defined in Collision" << std::endl;
-		return false;
-	}
-
-	LocationInSpace* objectLocationInSpace = (LocationInSpace*)propertyMap->at(locationsInSpace.at(objectId));
-	sf::Shape* objectShape = objectLocationInSpace->getObjectShape(objectId);
-	Collision* collisionProperty = (Collision*)propertyMap->at(collision);
-	std::map<int, int>* otherLocationsInSpace = collisionProperty->getLocationsInSpace();
-	std::vector<int> otherObjects = collisionProperty->getObjects();
-
-	//go through each object in other collision property, returning true if a collision is detected
-	int otherObjectsNum = otherObjects.size();
-	for (int i = 0; i < otherObjectsNum; i++)
-	{
-		int otherLocationInSpaceId = otherLocationsInSpace->at(otherObjects[i]);
-		LocationInSpace* otherLocationInSpace = (LocationInSpace*)propertyMap->at(otherLocationInSpaceId);
-		sf::Shape* otherObjectShape = otherLocationInSpace->getObjectShape(otherObjects[i]);
-
-		if (objectShape->getGlobalBounds().intersects(otherObjectShape->getGlobalBounds()))
-		{
-			return true;
-		}
-	}
-
-	//return false if no collisions detected
-	return false;
-}
-
-bool Collision::isCollidingWith(int objectId, int otherObjectId, int collision)
-{
-	if (!hasObject(objectId))
-	{
-		std::cerr << "No such object defined in Collision" << std::endl;
-		return false;
-	}
-
-	LocationInSpace* objectLocationInSpace = (LocationInSpace*)propertyMap->at(locationsInSpace.at(objectId));
-	sf::Shape* objectShape = objectLocationInSpace->getObjectShape(objectId);
-	Collision* collisionProperty = (Collision*)propertyMap->at(collision);
-	LocationInSpace* otherLocationInSpace = (LocationInSpace*)propertyMap->at(collisionProperty->getLocationsInSpace()->at(otherObjectId));
-	sf::Shape* otherObjectShape = otherLocationInSpace->getObjectShape(otherObjectId);
-
-	if (objectShape->getGlobalBounds().intersects(otherObjectShape->getGlobalBounds()))
-	{
-		return true;
-	}
-
-	//return false if no collision detected
-	return false;
-}
-
-
+#include "Collision.h"
+#include <iostream>
+#include "LocationInSpace.h"
+
+Collision::Collision(int id, PropertyRegistry* propertyRegistry) : Property(id, propertyRegistry)
+{
+	//construction taken care of in Property
+}
+
+void Collision::addObject(int objectId, int locationInSpaceId)
+{
+	if (hasObject(objectId))
+	{
+		std::cerr << "Cannot add duplicate object to Collision" << std::endl;
+		return;
+	}
+
+	objects.insert(objectId);
+	locationsInSpace.push_back(locationInSpaceId);
+}
+
+void Collision::removeObject(int objectId)
+{
+	//remove from objects list
+	int index = objects.remove(objectId);
+	if (index < 0)
+	{
+		std::cerr << "No such object defined in Collision" << std::endl;
+		return;
+	}
+
+	//remove LocationInSpace (the last object takes the removed object's index, as in objects)
+	swapRemove(locationsInSpace, index);
+}
+
+int Collision::getLocationInSpaceAt(int index)
+{
+	return locationsInSpace[index];
+}
+
+const std::vector<int>& Collision::getObjects()
+{
+	return objects.getIds();
+}
+
+bool Collision::isCollidingWithAny(int objectId, int collision)
+{
+	int index = objects.indexOf(objectId);
+	if (index < 0)
+	{
+		std::cerr << "No such object defined in Collision" << std::endl;
+		return false;
+	}
+
+	LocationInSpace* objectLocationInSpace = propertyRegistry->get<LocationInSpace>(locationsInSpace[index]);
+	const Transform::Bounds* objectBounds = objectLocationInSpace->getObjectBounds(objectId);
+	if (objectBounds == nullptr)
+	{
+		std::cerr << "No such object defined in LocationInSpace" << std::endl;
+		return false;
+	}
+
+	Collision* collisionProperty = propertyRegistry->get<Collision>(collision);
+
+	//go through each object in other collision property, returning true if a collision is detected
+	int otherObjectsNum = collisionProperty->getObjectsNum();
+	for (int i = 0; i < otherObjectsNum; i++)
+	{
+		LocationInSpace* otherLocationInSpace = propertyRegistry->get<LocationInSpace>(collisionProperty->getLocationInSpaceAt(i));
+		const Transform::Bounds* otherObjectBounds = otherLocationInSpace->getObjectBounds(collisionProperty->getObjectAt(i));
+
+		//an object missing from its LocationInSpace has nowhere to collide
+		if (otherObjectBounds != nullptr && objectBounds->intersects(*otherObjectBounds))
+		{
+			return true;
+		}
+	}
+
+	//return false if no collisions detected
+	return false;
+}
+
+bool Collision::isCollidingWith(int objectId, int otherObjectId, int collision)
+{
+	int index = objects.indexOf(objectId);
+	if (index < 0)
+	{
+		std::cerr << "No such object defined in Collision" << std::endl;
+		return false;
+	}
+
+	LocationInSpace* objectLocationInSpace = propertyRegistry->get<LocationInSpace>(locationsInSpace[index]);
+	const Transform::Bounds* objectBounds = objectLocationInSpace->getObjectBounds(objectId);
+	if (objectBounds == nullptr)
+	{
+		std::cerr << "No such object defined in LocationInSpace" << std::endl;
+		return false;
+	}
+
+	Collision* collisionProperty = propertyRegistry->get<Collision>(collision);
+	int otherIndex = collisionProperty->getIndexOf(otherObjectId);
+	if (otherIndex < 0)
+	{
+		std::cerr << "No such object defined in other Collision" << std::endl;
+		return false;
+	}
+
+	LocationInSpace* otherLocationInSpace = propertyRegistry->get<LocationInSpace>(collisionProperty->getLocationInSpaceAt(otherIndex));
+	const Transform::Bounds* otherObjectBounds = otherLocationInSpace->getObjectBounds(otherObjectId);
+	if (otherObjectBounds == nullptr)
+	{
+		std::cerr << "No such object defined in other LocationInSpace" << std::endl;
+		return false;
+	}
+
+	if (objectBounds->intersects(*otherObjectBounds))
+	{
+		return true;
+	}
+
+	//return false if no collision detected
+	return false;
+}
+
+
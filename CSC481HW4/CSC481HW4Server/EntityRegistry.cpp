@@ -0,0 +1,48 @@
+#include "EntityRegistry.h"
+#include <iostream>
+
+int EntityRegistry::create()
+{
+	int index;
+
+	//reuse a free slot if there is one
+	if (!freeIndices.empty())
+	{
+		index = freeIndices.back();
+		freeIndices.pop_back();
+	}
+	else
+	{
+		index = generations.size();
+		if (index > INDEX_MASK)
+		{
+			std::cerr << "Unable to create object: all entity slots in use" << std::endl;
+			return -1;
+		}
+		generations.push_back(0);
+		aliveValues.push_back(false);
+	}
+
+	aliveValues[index] = true;
+	return (generations[index] << INDEX_BITS) | index;
+}
+
+void EntityRegistry::destroy(int handle)
+{
+	if (!isAlive(handle))
+	{
+		std::cerr << "Unable to destroy object: handle is stale or was never created" << std::endl;
+		return;
+	}
+
+	//bump generation so existing copies of the handle no longer match
+	int index = getIndex(handle);
+	aliveValues[index] = false;
+	generations[index] = generations[index] == MAX_GENERATION ? 0 : generations[index] + 1;
+	freeIndices.push_back(index);
+}
+
+int EntityRegistry::getAliveNum()
+{
+	return generations.size() - freeIndices.size();
+}
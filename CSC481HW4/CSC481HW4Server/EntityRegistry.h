@@ -0,0 +1,95 @@
+#pragma once
+#include <vector>
+
+/*
+* Hands out ids for game objects as generational handles. The low INDEX_BITS bits of a handle are a slot index and the rest are
+* the slot's generation, which goes up each time an object in the slot is destroyed. Slots of destroyed objects are reused, so
+* ids stay small enough to index arrays directly (see SparseSet), while a handle kept around after its object was destroyed
+* (such as in an event raised for a character whose client has since disconnected) no longer matches the slot's generation and
+* is recognized as stale with a single comparison.
+*
+* The first object in each slot has generation 0, so its handle is just the slot index.
+*/
+class EntityRegistry
+{
+	public:
+		/* number of low bits of a handle holding the slot index */
+		static const int INDEX_BITS = 20;
+
+		/* mask selecting the slot index from a handle */
+		static const int INDEX_MASK = (1 << INDEX_BITS) - 1;
+
+		/* largest generation before wrapping back around to 0 (keeps handles positive) */
+		static const int MAX_GENERATION = (1 << (31 - INDEX_BITS)) - 1;
+
+		/*
+		* Returns the slot index of the given handle.
+		*
+		* handle: handle of object
+		*
+		* returns: slot index
+		*/
+		static int getIndex(int handle)
+		{
+			return handle & INDEX_MASK;
+		}
+
+		/*
+		* Returns the generation of the given handle.
+		*
+		* handle: handle of object
+		*
+		* returns: generation
+		*/
+		static int getGeneration(int handle)
+		{
+			return handle >> INDEX_BITS;
+		}
+
+	private:
+		/* current generation of each slot */
+		std::vector<int> generations;
+
+		/* whether each slot currently holds an object */
+		std::vector<char> aliveValues;
+
+		/* slots of destroyed objects, available for reuse */
+		std::vector<int> freeIndices;
+
+	public:
+		/*
+		* Creates a new object, reusing the slot of a destroyed one if there is any.
+		*
+		* returns: handle of new object
+		*/
+		int create();
+
+		/*
+		* Destroys the given object, so its handle (and any copies of it) become stale and its slot can be reused. The object should
+		* already have been removed from every property.
+		*
+		* handle: handle of object
+		*/
+		void destroy(int handle);
+
+		/*
+		* Returns whether the given handle refers to an object that still exists.
+		*
+		* handle: handle of object
+		*
+		* returns: true if object exists, false if it was destroyed (or never created)
+		*/
+		bool isAlive(int handle)
+		{
+			int index = getIndex(handle);
+			return handle >= 0 && index < (int)generations.size() && aliveValues[index]
+				&& generations[index] == getGeneration(handle);
+		}
+
+		/*
+		* Returns the number of objects that currently exist.
+		*
+		* returns: number of objects
+		*/
+		int getAliveNum();
+};
@@ -1,52 +1,78 @@
-#include "Event.h"
-
-Event::Event(float timestamp, std::string type, std::vector<ArgumentVariant> arguments)
-{
-	this->timestamp = timestamp;
-	this->type = type;
-	this->arguments = arguments;
-}
-
-Event::ArgumentVariant Event::getArgument(int index)
-{
-	return arguments[index];
-}
-
-std::string Event::toString()
-{
-	std::string eventStr = std::to_string(timestamp) + " " + type;
-	int argNum = arguments.size();
-	for (int i = 0; i < argNum; i++)
-	{
-		if (arguments[i].argType == ArgumentType::TYPE_INTEGER)
-		{
-			eventStr += " " + std::to_string(arguments[i].argValue.argAsInt);
-		}
-		else if (arguments[i].argType == ArgumentType::TYPE_FLOAT)
-		{
-			eventStr += " " + std::to_string(arguments[i].argValue.argAsInt);
-		}
-	}
-
-	return eventStr;
-}
-
-float Event::getTimestamp()
-{
-	return timestamp;
-}
-
-void Event::setTimestamp(float timestamp)
-{
-	this->timestamp = timestamp;
-}
-
-std::string Event::getType()
-{
-	return type;
-}
-
-std::vector<Event::ArgumentVariant> Event::getArguments()
-{
-	return arguments;
-}
+#include "Event.h"
+#include "EventManager.h"
+#include <iostream>
+#include <cstring>
+
+Event::Event(float timestamp, int type, const void* payload, int payloadSize)
+{
+	reset(timestamp, type, payload, payloadSize);
+}
+
+void Event::reset(float timestamp, int type, const void* payload, int payloadSize)
+{
+	this->timestamp = timestamp;
+	this->type = type;
+	setPayload(payload, payloadSize);
+}
+
+void Event::setPayload(const void* payload, int payloadSize)
+{
+	if (payloadSize > MAX_PAYLOAD_SIZE)
+	{
+		std::cerr << "Event payload too large (" + std::to_string(payloadSize) + " bytes), only keeping first "
+			+ std::to_string(MAX_PAYLOAD_SIZE) << std::endl;
+		payloadSize = MAX_PAYLOAD_SIZE;
+	}
+
+	memcpy(this->payload, payload, payloadSize);
+	this->payloadSize = payloadSize;
+}
+
+const void* Event::getPayloadData()
+{
+	return payload;
+}
+
+int Event::getPayloadSize()
+{
+	return payloadSize;
+}
+
+std::string Event::toString()
+{
+	std::string eventStr = std::to_string(timestamp) + " " + EventManager::getManager()->getEventTypeName(type);
+
+	//payload is written by its schema
+	std::string payloadStr = EventManager::getManager()->payloadToString(type, payload);
+	if (!payloadStr.empty())
+	{
+		eventStr += " " + payloadStr;
+	}
+
+	return eventStr;
+}
+
+float Event::getTimestamp()
+{
+	return timestamp;
+}
+
+void Event::setTimestamp(float timestamp)
+{
+	this->timestamp = timestamp;
+}
+
+std::chrono::steady_clock::time_point Event::getRaisedAt()
+{
+	return raisedAt;
+}
+
+void Event::setRaisedAt(std::chrono::steady_clock::time_point raisedAt)
+{
+	this->raisedAt = raisedAt;
+}
+
+int Event::getType()
+{
+	return type;
+}
@@ -1,100 +1,135 @@
-#pragma once
-#include <string>
-#include <vector>
-
-/*
-* Class representing an event of a particular type with a set of arguments. Events can be raised and handled by an event system
-* to coordinate functionality.
-*/
-class Event
-{
-	public:
-		/*
-		* Enum representing the possible types for event arguments.
-		*/
-		enum ArgumentType
-		{
-			TYPE_INTEGER,
-			TYPE_FLOAT
-		};
-
-		/*
-		* A variant that represents a particular event argument by maintaining its type and value.
-		*/
-		struct ArgumentVariant
-		{
-			ArgumentType argType;
-
-			union
-			{
-				int argAsInt;
-				float argAsFloat;
-			} argValue;
-		};
-
-	private:
-		/* time at which the event should be handled */
-		float timestamp;
-
-		/* type of the event */
-		std::string type;
-
-		/* arguments for the event */
-		std::vector<ArgumentVariant> arguments;
-
-	public:
-		/*
-		* Constructs an event with the given values.
-		* 
-		* timestamp: time at which the event should be handled
-		* type: type of the event
-		* arguments: list of event arguments
-		*/
-		Event(float timestamp, std::string type, std::vector<ArgumentVariant> arguments);
-
-		/*
-		* Retrieves the argument at the given index.
-		* 
-		* index: index at which to retrieve argument
-		* 
-		* returns: argument at given index
-		*/
-		ArgumentVariant getArgument(int index);
-
-		/*
-		* Returns a string with the values of timestamp, type, and each argument in order separated by spaces. Generally used
-		* for enabling sending events as strings across client and server.
-		* 
-		* returns: string representation of event
-		*/
-		std::string toString();
-
-		/*
-		* Returns the event's time to be handled.
-		* 
-		* returns: time at which event should be handled
-		*/
-		float getTimestamp();
-
-		/*
-		* Sets the event's timestamp to the given value.
-		* 
-		* timestamp: time at which event should be handled
-		*/
-		void setTimestamp(float timestamp);
-
-		/*
-		* Returns the event's type.
-		* 
-		* returns: event's type
-		*/
-		std::string getType();
-
-		/*
-		* Returns the list of event arguments.
-		* 
-		* returns: list of event arguments
-		*/
-		std::vector<ArgumentVariant> getArguments();
-};
-
+#pragma once
+#include <string>
+#include <chrono>
+#include <cassert>
+#include <new>
+
+/*
+* Class representing an event of a particular type with a payload. Events can be raised and handled by an event system
+* to coordinate functionality.
+* 
+* The payload is one of the structs in EventSchemas (chosen by the event type) and is stored unboxed inside the event, so handlers
+* read it back as that struct with getPayload.
+*/
+class Event
+{
+	public:
+		/* maximum size of an event's payload in bytes (movement payloads are currently the largest, with 6 fields) */
+		static const int MAX_PAYLOAD_SIZE = 24;
+
+	private:
+		/* time at which the event should be handled */
+		float timestamp;
+
+		/* type of the event (id registered with the EventManager) */
+		int type;
+
+		/* payload of the event (stored inline so that creating an event never allocates) */
+		alignas(8) unsigned char payload[MAX_PAYLOAD_SIZE];
+
+		/* size of the payload in bytes */
+		int payloadSize;
+
+		/* wall-clock time at which the event was raised (used by the EventManager to measure how long events wait) */
+		std::chrono::steady_clock::time_point raisedAt;
+
+		/*
+		* Copies the given payload into the event's inline storage. Anything past MAX_PAYLOAD_SIZE is dropped.
+		* 
+		* payload: payload to copy
+		* payloadSize: size of payload in bytes
+		*/
+		void setPayload(const void* payload, int payloadSize);
+
+	public:
+		/*
+		* Constructs an event with the given values, copying the payload from existing storage (such as another event's).
+		* 
+		* timestamp: time at which the event should be handled
+		* type: type of the event
+		* payload: payload of the event
+		* payloadSize: size of payload in bytes
+		*/
+		Event(float timestamp, int type, const void* payload, int payloadSize);
+
+		/*
+		* Overwrites all of the event's values so that it can be reused for a new event. Used by the EventManager when recycling
+		* handled events.
+		* 
+		* timestamp: time at which the event should be handled
+		* type: type of the event
+		* payload: payload of the event
+		* payloadSize: size of payload in bytes
+		*/
+		void reset(float timestamp, int type, const void* payload, int payloadSize);
+
+		/*
+		* Returns the event's payload as the given EventSchemas struct, which must be the payload of the event's type.
+		* 
+		* returns: event's payload
+		*/
+		template <typename Payload>
+		Payload& getPayload()
+		{
+			assert(Payload::isPayloadOf(type));
+			return *reinterpret_cast<Payload*>(payload);
+		}
+
+		/*
+		* Returns the event's payload without interpreting it (such as for copying the event).
+		* 
+		* returns: payload bytes (of length getPayloadSize())
+		*/
+		const void* getPayloadData();
+
+		/*
+		* Returns the size of the event's payload.
+		* 
+		* returns: size of payload in bytes
+		*/
+		int getPayloadSize();
+
+		/*
+		* Returns a string with the values of timestamp, type name, and each payload field in order separated by spaces. Generally used
+		* for logging and for sending events as strings.
+		* 
+		* returns: string representation of event
+		*/
+		std::string toString();
+
+		/*
+		* Returns the event's time to be handled.
+		* 
+		* returns: time at which event should be handled
+		*/
+		float getTimestamp();
+
+		/*
+		* Sets the event's timestamp to the given value.
+		* 
+		* timestamp: time at which event should be handled
+		*/
+		void setTimestamp(float timestamp);
+
+		/*
+		* Returns the wall-clock time at which the event was raised.
+		* 
+		* returns: time at which event was raised
+		*/
+		std::chrono::steady_clock::time_point getRaisedAt();
+
+		/*
+		* Sets the wall-clock time at which the event was raised. Set by the EventManager when raising the event.
+		* 
+		* raisedAt: time at which event was raised
+		*/
+		void setRaisedAt(std::chrono::steady_clock::time_point raisedAt);
+
+		/*
+		* Returns the event's type.
+		* 
+		* returns: event's type id
+		*/
+		int getType();
+};
+
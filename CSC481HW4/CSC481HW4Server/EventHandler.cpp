@@ -1,12 +1,71 @@
-#include "EventHandler.h"
-
-EventHandler::EventHandler(std::map<int, Property*>* propertyMap, bool notifyWhileReplaying)
-{
-	this->propertyMap = propertyMap;
-	this->notifyWhileReplaying = notifyWhileReplaying;
-}
-
-bool EventHandler::isSetToNotifyWhileReplaying()
-{
-	return notifyWhileReplaying;
-}
+#include "EventHandler.h"
+#include <algorithm>
+
+EventHandler::EventHandler(PropertyRegistry* propertyRegistry, bool notifyWhileReplaying)
+{
+	this->propertyRegistry = propertyRegistry;
+	this->notifyWhileReplaying = notifyWhileReplaying;
+	this->propertyAccessDeclared = false;
+}
+
+bool EventHandler::isSetToNotifyWhileReplaying()
+{
+	return notifyWhileReplaying;
+}
+
+void EventHandler::onDispatchEnd()
+{
+}
+
+void EventHandler::declarePropertyAccess(std::vector<int> readProperties, std::vector<int> writeProperties)
+{
+	this->readProperties = readProperties;
+	this->writeProperties = writeProperties;
+	this->propertyAccessDeclared = true;
+}
+
+bool EventHandler::hasDeclaredPropertyAccess()
+{
+	return propertyAccessDeclared;
+}
+
+bool EventHandler::conflictsWith(const std::vector<int>& readProperties, const std::vector<int>& writeProperties)
+{
+	if (!propertyAccessDeclared)
+	{
+		return true;
+	}
+
+	//our writes conflict with any of their accesses
+	int ourWritesNum = this->writeProperties.size();
+	for (int i = 0; i < ourWritesNum; i++)
+	{
+		if (std::find(readProperties.begin(), readProperties.end(), this->writeProperties[i]) != readProperties.end()
+			|| std::find(writeProperties.begin(), writeProperties.end(), this->writeProperties[i]) != writeProperties.end())
+		{
+			return true;
+		}
+	}
+
+	//our reads conflict with their writes
+	int ourReadsNum = this->readProperties.size();
+	for (int i = 0; i < ourReadsNum; i++)
+	{
+		if (std::find(writeProperties.begin(), writeProperties.end(), this->readProperties[i]) != writeProperties.end())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+const std::vector<int>& EventHandler::getReadProperties()
+{
+	return readProperties;
+}
+
+const std::vector<int>& EventHandler::getWriteProperties()
+{
+	return writeProperties;
+}
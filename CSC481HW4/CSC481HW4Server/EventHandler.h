@@ -1,41 +1,102 @@
-#pragma once
-#include "Event.h"
-#include <map>
-#include "Property.h"
-
-/*
-* Abstract class defining general behavior required for handling different event types.
-*/
-class EventHandler
-{
-	protected:
-		/* map of all properties */
-		std::map<int, Property*>* propertyMap;
-
-		/* whether the EventManager should notify this handler of events when a replay is being played */
-		bool notifyWhileReplaying;
-
-	public:
-		/*
-		* Constructs an EventHandler with the given property map.
-		* 
-		* propertyMap: map of all properties
-		* notifyWhileReplaying: whether to notify this handler of events when a replay is being played
-		*/
-		EventHandler(std::map<int, Property*>* propertyMap, bool notifyWhileReplaying);
-
-		/*
-		* Function to be defined in subclasses that performs different actions based on the type of the given event.
-		* 
-		* e: event to handle
-		*/
-		virtual void onEvent(Event* e) = 0;
-
-		/*
-		* Returns indicating whether the handler should be notified of events while a replay is being played.
-		* 
-		* returns: true if handler should be notified of events while replay is playing, false otherwise
-		*/
-		bool isSetToNotifyWhileReplaying();
-};
-
+#pragma once
+#include "Event.h"
+#include <map>
+#include <vector>
+#include "Property.h"
+
+/*
+* Abstract class defining general behavior required for handling different event types.
+*/
+class EventHandler
+{
+	protected:
+		/* registry of all properties */
+		PropertyRegistry* propertyRegistry;
+
+		/* whether the EventManager should notify this handler of events when a replay is being played */
+		bool notifyWhileReplaying;
+
+		/* whether the handler has declared which properties it reads and writes */
+		bool propertyAccessDeclared;
+
+		/* ids of properties the handler reads (if declared) */
+		std::vector<int> readProperties;
+
+		/* ids of properties the handler writes (if declared) */
+		std::vector<int> writeProperties;
+
+	public:
+		/*
+		* Constructs an EventHandler with the given property registry.
+		* 
+		* propertyRegistry: registry of all properties
+		* notifyWhileReplaying: whether to notify this handler of events when a replay is being played
+		*/
+		EventHandler(PropertyRegistry* propertyRegistry, bool notifyWhileReplaying);
+
+		/*
+		* Function to be defined in subclasses that performs different actions based on the type of the given event.
+		* 
+		* e: event to handle
+		*/
+		virtual void onEvent(Event* e) = 0;
+
+		/*
+		* Called at the end of each pass of event handling, once no more events are due, for handlers registered with
+		* EventManager::registerForDispatchEnd. Lets handlers that gather events over a pass raise what they've gathered; any due
+		* events raised here are handled in the same pass. Does nothing by default.
+		*/
+		virtual void onDispatchEnd();
+
+		/*
+		* Returns indicating whether the handler should be notified of events while a replay is being played.
+		* 
+		* returns: true if handler should be notified of events while replay is playing, false otherwise
+		*/
+		bool isSetToNotifyWhileReplaying();
+
+		/*
+		* Declares every property the handler reads or writes while handling events, including properties reached indirectly (such
+		* as the LocationInSpace behind a Collision). Once declared, the EventManager may run this handler at the same time as other
+		* handlers whose accesses don't conflict with it, so a declaring handler must only touch its declared properties and must
+		* not register or unregister for events, change replay state, or keep state shared with other handlers. Handlers that
+		* never declare are always run on their own.
+		* 
+		* readProperties: ids of properties read
+		* writeProperties: ids of properties written
+		*/
+		void declarePropertyAccess(std::vector<int> readProperties, std::vector<int> writeProperties);
+
+		/*
+		* Returns whether the handler has declared which properties it accesses.
+		* 
+		* returns: true if access has been declared, false otherwise
+		*/
+		bool hasDeclaredPropertyAccess();
+
+		/*
+		* Returns whether the handler's declared property accesses conflict with the given ones, meaning one of them writes a
+		* property that the other reads or writes. Handlers that have not declared access conflict with everything.
+		* 
+		* readProperties: ids of properties read by other handler(s)
+		* writeProperties: ids of properties written by other handler(s)
+		* 
+		* returns: true if accesses conflict, false otherwise
+		*/
+		bool conflictsWith(const std::vector<int>& readProperties, const std::vector<int>& writeProperties);
+
+		/*
+		* Returns the ids of properties the handler has declared it reads.
+		* 
+		* returns: ids of properties read
+		*/
+		const std::vector<int>& getReadProperties();
+
+		/*
+		* Returns the ids of properties the handler has declared it writes.
+		* 
+		* returns: ids of properties written
+		*/
+		const std::vector<int>& getWriteProperties();
+};
+
@@ -1,200 +1,741 @@
-#include "EventManager.h"
-#include <stdexcept>
-#include <iostream>
-
-EventManager* EventManager::manager = nullptr;
-
-EventManager::EventManager()
-{
-	this->timeline = nullptr;
-	this->replayTimeline = nullptr;
-	this->playingReplay = false;
-	this->replayStartTime = 0.f;
-}
-
-void EventManager::setTimeline(Timeline* timeline)
-{
-	this->timeline = timeline;
-}
-
-void EventManager::setEventTypes(std::vector<std::string> eventTypes)
-{
-	int eventTypesNum = eventTypes.size();
-	for (int i = 0; i < eventTypesNum; i++)
-	{
-		eventRegistrations.insert(std::pair<std::string, std::vector<EventHandler*>>(eventTypes[i], {}));
-	}
-}
-
-void EventManager::registerForEvent(std::string eventType, EventHandler* eventHandler)
-{
-	try
-	{
-		eventRegistrations.at(eventType).push_back(eventHandler);
-	}
-	catch (const std::out_of_range oor)
-	{
-		std::cerr << "No such event type: " + eventType << std::endl;
-	}
-}
-
-void EventManager::unregisterForEvent(std::string eventType, EventHandler* eventHandler)
-{
-	try
-	{
-		std::vector<EventHandler*> handlers = eventRegistrations.at(eventType);
-		int handlersNum = handlers.size();
-		for (int i = 0; i < handlersNum; i++)
-		{
-			if (handlers[i] == eventHandler)
-			{
-				handlers.erase(handlers.begin() + i);
-				break;
-			}
-		}
-	}
-	catch (const std::out_of_range oor)
-	{
-		std::cerr << "No such event type: " + eventType << std::endl;
-	}
-}
-
-void EventManager::raise(Event* e)
-{
-	//if playing replay, queue in event queue
-	if (playingReplay)
-	{
-		replayEventQueue.push(e);
-	}
-	//otherwise, queue in regular queue
-	else
-	{
-		eventQueue.push(e);
-	}
-}
-
-void EventManager::handleEvents()
-{
-	if (playingReplay)
-	{
-		//std::cout << "Handling replay events" << std::endl;
-		//std::cout << std::to_string(replayTimeline->getTime()) << std::endl;
-		//std::cout << std::to_string(replayEventQueue.top()->getTimestamp()) << std::endl;
-		//std::cout << replayEventQueue.top()->getType() << std::endl;
-
-		//retrieve absolute time to use in determining which events to handle
-		float currentTime = getReplayTime() * replayTimeline->getTic();
-
-		//while queue is not empty and highest priority event has timestamp less than or equal to current time, continue handling events
-		while (!replayEventQueue.empty() && (replayEventQueue.top()->getTimestamp() + (replayStartTime / replayTimeline->getTic()) < (currentTime / replayTimeline->getTic())
-			|| fabs((currentTime / replayTimeline->getTic()) - (replayEventQueue.top()->getTimestamp() + (replayStartTime / replayTimeline->getTic()))) < FLT_EPSILON))
-		{
-
-			//get list of handlers registered for this event
-			std::vector<EventHandler*> registeredHandlers = eventRegistrations.at(replayEventQueue.top()->getType());
-			int registeredHandlersNum = registeredHandlers.size();
-
-			//call function for each handler
-			for (int i = 0; i < registeredHandlersNum; i++)
-			{
-				//only notify handler if handler is set to notify while replaying
-				if (registeredHandlers[i]->isSetToNotifyWhileReplaying())
-				{
-					registeredHandlers[i]->onEvent(replayEventQueue.top());
-				}
-			}
-
-			//remove event from queue
-			replayEventQueue.pop();
-		}
-
-		//check if replay is finished
-		if (replayEventQueue.empty())
-		{
-			setPlayingReplay(false);
-
-		}
-	}
-	else
-	{
-		//retrieve time to use in determining which events to handle
-		float currentTime = getCurrentTime();
-
-		//while queue is not empty and highest priority event has timestamp less than or equal to current time, continue handling events
-		while (!eventQueue.empty() && (eventQueue.top()->getTimestamp() < currentTime
-			|| fabs(currentTime - eventQueue.top()->getTimestamp()) < FLT_EPSILON))
-		{
-			//get list of handlers registered for this event
-			std::vector<EventHandler*> registeredHandlers = eventRegistrations.at(eventQueue.top()->getType());
-			int registeredHandlersNum = registeredHandlers.size();
-
-			//call function for each handler
-			for (int i = 0; i < registeredHandlersNum; i++)
-			{
-				registeredHandlers[i]->onEvent(eventQueue.top());
-			}
-
-			//remove event from queue
-			eventQueue.pop();
-
-		}
-	}
-}
-
-float EventManager::getCurrentTime()
-{
-	return timeline->getTime();
-}
-
-bool EventManager::isPlayingReplay()
-{
-	return playingReplay;
-}
-
-void EventManager::setPlayingReplay(bool playingReplay)
-{
-	this->playingReplay = playingReplay;
-
-	//if we are now playing replay, record the replay start time unrelative to the speed
-	if (this->playingReplay)
-	{
-		replayStartTime = replayTimeline->getTime() * replayTimeline->getTic();
-	}
-}
-
-void EventManager::setReplayTimeline(Timeline* replayTimeline)
-{
-	this->replayTimeline = replayTimeline;
-}
-
-float EventManager::getReplayTime()
-{
-	return replayTimeline->getTime();
-}
-
-void EventManager::setReplaySpeed(float ticSize)
-{
-	replayTimeline->setTic(ticSize);
-}
-
-bool EventManager::isRegistered(std::string eventType, EventHandler* eventHandler)
-{
-	try
-	{
-		std::vector<EventHandler*> handlers = eventRegistrations.at(eventType);
-		int handlersNum = handlers.size();
-		for (int i = 0; i < handlersNum; i++)
-		{
-			if (handlers[i] == eventHandler)
-			{
-				return true;
-			}
-		}
-	}
-	catch (const std::out_of_range oor)
-	{
-		std::cerr << "No such event type: " + eventType << std::endl;
-	}
-
-	return false;
-}
+#include "EventManager.h"
+#include <stdexcept>
+#include <iostream>
+#include <thread>
+#include <typeinfo>
+#include <iomanip>
+
+EventManager* EventManager::manager = nullptr;
+
+namespace
+{
+	/* if set, events raised on this thread are added here instead of to the event queue (see EventManager::runWave) */
+	thread_local std::vector<Event*>* raisedEventsBuffer = nullptr;
+
+	/*
+	* Returns the number of nanoseconds between the given times.
+	*/
+	unsigned long long nanosecondsBetween(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+	{
+		long long nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+		return nanoseconds > 0 ? (unsigned long long)nanoseconds : 0;
+	}
+
+	/*
+	* Prints the count and percentiles of a histogram of nanosecond values, in microseconds.
+	*/
+	void printHistogram(std::ostream& out, LatencyHistogram& histogram)
+	{
+		std::streamsize oldPrecision = out.precision();
+		out << "n=" << histogram.getCount() << std::fixed << std::setprecision(1)
+			<< " p50=" << histogram.getValueAtPercentile(50.0) / 1000.0
+			<< " p90=" << histogram.getValueAtPercentile(90.0) / 1000.0
+			<< " p99=" << histogram.getValueAtPercentile(99.0) / 1000.0
+			<< " p99.9=" << histogram.getValueAtPercentile(99.9) / 1000.0
+			<< " max=" << histogram.getMax() / 1000.0 << " us";
+		out.unsetf(std::ios_base::floatfield);
+		out.precision(oldPrecision);
+	}
+}
+
+EventManager::EventManager() : eventQueue(EVENT_QUEUE_SLOT_SIZE, EVENT_QUEUE_SLOTS_NUM),
+	behaviorQueue(EVENT_QUEUE_SLOT_SIZE, EVENT_QUEUE_SLOTS_NUM), replayEventQueue(EVENT_QUEUE_SLOT_SIZE, EVENT_QUEUE_SLOTS_NUM),
+	ingressQueue(INGRESS_QUEUE_CAPACITY)
+{
+	this->timeline = nullptr;
+	this->replayTimeline = nullptr;
+	this->playingReplay = false;
+	this->replayStartTime = 0.f;
+	this->eventsAllocated = 0;
+	this->eventsInUse = 0;
+	this->dispatchGeneration = 0;
+	this->dispatching = false;
+	this->registrationsToCompact = false;
+	this->waveTasksNum = 0;
+	this->statsDumpInterval = 0.f;
+	this->eventQueueDepth = { 0, 0 };
+	this->replayEventQueueDepth = { 0, 0 };
+	this->ingressQueueDepth = { 0, 0 };
+	this->behaviorQueueDepth = { 0, 0 };
+	resetStats();
+
+	//the thread handling events works on waves too, so only start workers for the remaining cores
+	unsigned int coresNum = std::thread::hardware_concurrency();
+	this->workerPool = coresNum > 1 ? new WorkerPool(coresNum - 1) : nullptr;
+}
+
+void EventManager::setTimeline(Timeline* timeline)
+{
+	this->timeline = timeline;
+}
+
+void EventManager::setEventTypes(std::map<int, std::string> eventTypes)
+{
+	for (std::map<int, std::string>::iterator it = eventTypes.begin(); it != eventTypes.end(); it++)
+	{
+		if (it->first < 0)
+		{
+			std::cerr << "Invalid event type id: " + std::to_string(it->first) << std::endl;
+			continue;
+		}
+
+		//grow tables so that type id can be used directly as an index
+		if (it->first >= (int)eventRegistrations.size())
+		{
+			eventRegistrations.resize(it->first + 1);
+			eventTypeNames.resize(it->first + 1);
+			eventSchemas.resize(it->first + 1, { 0, nullptr });
+
+			std::lock_guard<std::mutex> guard(statsLock);
+			eventTypeStats.resize(it->first + 1);
+		}
+
+		eventTypeNames[it->first] = it->second;
+	}
+}
+
+std::string EventManager::getEventTypeName(int eventType)
+{
+	if (eventType < 0 || eventType >= (int)eventTypeNames.size())
+	{
+		return "";
+	}
+
+	return eventTypeNames[eventType];
+}
+
+std::string EventManager::payloadToString(int eventType, const void* payload)
+{
+	if (eventType < 0 || eventType >= (int)eventSchemas.size() || eventSchemas[eventType].payloadToString == nullptr)
+	{
+		return "";
+	}
+
+	return eventSchemas[eventType].payloadToString(payload);
+}
+
+void EventManager::registerForEvent(int eventType, EventHandler* eventHandler)
+{
+	try
+	{
+		std::vector<HandlerRegistration>& registrations = eventRegistrations.at(eventType);
+
+		//share stats between all of the handler's registrations
+		HandlerStats*& stats = handlerStats[eventHandler];
+		if (stats == nullptr)
+		{
+			stats = new HandlerStats();
+			stats->name = typeid(*eventHandler).name();
+		}
+
+		HandlerRegistration registration = { eventHandler, dispatchGeneration, true, stats };
+		registrations.push_back(registration);
+	}
+	catch (const std::out_of_range oor)
+	{
+		std::cerr << "No such event type: " + std::to_string(eventType) << std::endl;
+	}
+}
+
+void EventManager::registerForDispatchEnd(EventHandler* eventHandler)
+{
+	dispatchEndHandlers.push_back(eventHandler);
+}
+
+void EventManager::unregisterForEvent(int eventType, EventHandler* eventHandler)
+{
+	try
+	{
+		std::vector<HandlerRegistration>& registrations = eventRegistrations.at(eventType);
+		int registrationsNum = registrations.size();
+		for (int i = 0; i < registrationsNum; i++)
+		{
+			if (registrations[i].active && registrations[i].handler == eventHandler)
+			{
+				//mark inactive rather than erasing, since we might be partway through dispatching to this list
+				registrations[i].active = false;
+				registrationsToCompact = true;
+				break;
+			}
+		}
+
+		//if not dispatching, we can compact right away
+		if (!dispatching)
+		{
+			compactRegistrations();
+		}
+	}
+	catch (const std::out_of_range oor)
+	{
+		std::cerr << "No such event type: " + std::to_string(eventType) << std::endl;
+	}
+}
+
+Event* EventManager::createEvent(float timestamp, int type, const void* payload, int payloadSize)
+{
+	std::lock_guard<std::mutex> guard(poolLock);
+	eventsInUse++;
+
+	//reuse a released event if there is one
+	if (!freeEvents.empty())
+	{
+		Event* e = freeEvents.back();
+		freeEvents.pop_back();
+		e->reset(timestamp, type, payload, payloadSize);
+		return e;
+	}
+
+	//otherwise, grow the pool
+	eventsAllocated++;
+	return new Event(timestamp, type, payload, payloadSize);
+}
+
+void EventManager::releaseEvent(Event* e)
+{
+	std::lock_guard<std::mutex> guard(poolLock);
+	eventsInUse--;
+	freeEvents.push_back(e);
+}
+
+unsigned long long EventManager::getEventsAllocated()
+{
+	return eventsAllocated;
+}
+
+int EventManager::getEventsInUse()
+{
+	return eventsInUse;
+}
+
+void EventManager::raise(Event* e)
+{
+	e->setRaisedAt(std::chrono::steady_clock::now());
+
+	//if raised by a handler running in parallel with others, hold on to the event until they have all finished
+	if (raisedEventsBuffer != nullptr)
+	{
+		raisedEventsBuffer->push_back(e);
+		return;
+	}
+
+	enqueue(e);
+}
+
+void EventManager::enqueue(Event* e)
+{
+	int eventType = e->getType();
+	if (eventType >= 0 && eventType < (int)eventTypeStats.size())
+	{
+		eventTypeStats[eventType].raised++;
+	}
+
+	//if playing replay, queue in event queue
+	if (playingReplay)
+	{
+		replayEventQueue.push(e->getTimestamp(), e);
+	}
+	//otherwise, queue in regular queue
+	else
+	{
+		eventQueue.push(e->getTimestamp(), e);
+	}
+}
+
+bool EventManager::queueEvent(int type, const void* payload, int payloadSize)
+{
+	if (payloadSize > Event::MAX_PAYLOAD_SIZE)
+	{
+		std::cerr << "Event payload too large (" + std::to_string(payloadSize) + " bytes), only keeping first "
+			+ std::to_string(Event::MAX_PAYLOAD_SIZE) << std::endl;
+		payloadSize = Event::MAX_PAYLOAD_SIZE;
+	}
+
+	IngressEvent ingressEvent;
+	ingressEvent.type = type;
+	memcpy(ingressEvent.payload, payload, payloadSize);
+	ingressEvent.payloadSize = payloadSize;
+	ingressEvent.queuedAt = std::chrono::steady_clock::now();
+
+	if (!ingressQueue.push(ingressEvent))
+	{
+		countDropped(type, 1);
+		return false;
+	}
+
+	return true;
+}
+
+int EventManager::drainIngressQueue()
+{
+	//if playing replay, make sure to set time so that event will be taken care of right away
+	float eventTime = playingReplay ? 0.f : getCurrentTime();
+
+	int drainedNum = 0;
+	IngressEvent ingressEvent;
+	while (ingressQueue.pop(ingressEvent))
+	{
+		Event* e = createEvent(eventTime, ingressEvent.type, ingressEvent.payload, ingressEvent.payloadSize);
+		raise(e);
+
+		//measure latency from when the event was queued rather than when we got around to raising it
+		e->setRaisedAt(ingressEvent.queuedAt);
+		drainedNum++;
+	}
+
+	return drainedNum;
+}
+
+void EventManager::countDropped(int eventType, int droppedNum)
+{
+	std::lock_guard<std::mutex> guard(statsLock);
+	if (eventType >= 0 && eventType < (int)eventTypeStats.size())
+	{
+		eventTypeStats[eventType].dropped += droppedNum;
+	}
+}
+
+void EventManager::handleEvents()
+{
+	ingressQueueDepth.sample(drainIngressQueue());
+	eventQueueDepth.sample(eventQueue.size());
+	replayEventQueueDepth.sample(replayEventQueue.size());
+	behaviorQueueDepth.sample(behaviorQueue.size());
+
+	if (playingReplay)
+	{
+		//std::cout << "Handling replay events" << std::endl;
+		//std::cout << std::to_string(replayTimeline->getTime()) << std::endl;
+
+		//retrieve absolute time to use in determining which events to handle
+		float currentTime = getReplayTime() * replayTimeline->getTic();
+
+		//replay event timestamps are relative to the start of the replay, so measure time since then (adjusted by current speed)
+		float timeSinceReplayStart = (currentTime - replayStartTime) / replayTimeline->getTic();
+
+		//while there are events with timestamp less than or equal to time since start, continue handling events (events raised
+		//while handling may be due as well, so keep going until nothing more is due)
+		while (true)
+		{
+			if (!popDueEvents(replayEventQueue, timeSinceReplayStart))
+			{
+				notifyDispatchEnd();
+				if (!popDueEvents(replayEventQueue, timeSinceReplayStart))
+				{
+					break;
+				}
+			}
+
+			dispatch(dueEvents, true);
+		}
+
+		//check if replay is finished
+		if (replayEventQueue.empty())
+		{
+			setPlayingReplay(false);
+
+		}
+	}
+	else
+	{
+		//retrieve time to use in determining which events to handle
+		float currentTime = getCurrentTime();
+
+		//while there are events with timestamp less than or equal to current time, continue handling events (events raised
+		//while handling may be due as well, so keep going until nothing more is due)
+		while (true)
+		{
+			//carry on any behaviors whose wait is over (which may raise events of their own)
+			bool behaviorsResumed = resumeDueBehaviors(currentTime);
+
+			//once nothing is due, let handlers flush anything they've gathered over the pass, which may make more events due
+			if (!popDueEvents(eventQueue, currentTime))
+			{
+				if (behaviorsResumed)
+				{
+					continue;
+				}
+
+				notifyDispatchEnd();
+				if (!popDueEvents(eventQueue, currentTime))
+				{
+					break;
+				}
+			}
+
+			dispatch(dueEvents, false);
+		}
+	}
+
+	//print (and start over) stats if it's time to
+	if (statsDumpInterval > 0.f)
+	{
+		std::chrono::duration<float> sinceStatsStart = std::chrono::steady_clock::now() - statsStartTime;
+		if (sinceStatsStart.count() >= statsDumpInterval)
+		{
+			dumpStats(std::cout);
+			resetStats();
+		}
+	}
+}
+
+void EventManager::scheduleBehavior(float timestamp, std::coroutine_handle<> behavior)
+{
+	std::lock_guard<std::mutex> guard(behaviorQueueLock);
+	behaviorQueue.push(timestamp, behavior);
+}
+
+bool EventManager::resumeDueBehaviors(float time)
+{
+	//pop everything due first, since resumed behaviors may schedule themselves again
+	dueBehaviors.clear();
+	{
+		std::lock_guard<std::mutex> guard(behaviorQueueLock);
+		std::coroutine_handle<> behavior;
+		while (behaviorQueue.popReady(time, behavior))
+		{
+			dueBehaviors.push_back(behavior);
+		}
+	}
+
+	int dueBehaviorsNum = dueBehaviors.size();
+	for (int i = 0; i < dueBehaviorsNum; i++)
+	{
+		dueBehaviors[i].resume();
+	}
+
+	return dueBehaviorsNum > 0;
+}
+
+EventManager::Wait EventManager::waitFor(float delay)
+{
+	return Wait(getCurrentTime() + delay);
+}
+
+int EventManager::getBehaviorsWaiting()
+{
+	std::lock_guard<std::mutex> guard(behaviorQueueLock);
+	return behaviorQueue.size();
+}
+
+bool EventManager::popDueEvents(TimingWheel<Event*>& queue, float time)
+{
+	dueEvents.clear();
+
+	Event* e;
+	while (queue.popReady(time, e))
+	{
+		dueEvents.push_back(e);
+	}
+
+	return !dueEvents.empty();
+}
+
+void EventManager::notifyDispatchEnd()
+{
+	int dispatchEndHandlersNum = dispatchEndHandlers.size();
+	for (int i = 0; i < dispatchEndHandlersNum; i++)
+	{
+		dispatchEndHandlers[i]->onDispatchEnd();
+	}
+}
+
+void EventManager::dispatch(std::vector<Event*>& events, bool replaying)
+{
+	dispatching = true;
+
+	int eventsNum = events.size();
+	for (int i = 0; i < eventsNum; i++)
+	{
+		Event* e = events[i];
+		int eventType = e->getType();
+		if (eventType < 0 || eventType >= (int)eventRegistrations.size())
+		{
+			std::cerr << "No such event type: " + std::to_string(eventType) << std::endl;
+			continue;
+		}
+
+		//start a new generation so that handlers registering during this event's dispatch are skipped until the next event
+		dispatchGeneration++;
+		unsigned long long eventGeneration = dispatchGeneration;
+
+		EventTypeStats& stats = eventTypeStats[eventType];
+		stats.latency.record(nanosecondsBetween(e->getRaisedAt(), std::chrono::steady_clock::now()));
+		bool notified = false;
+
+		//iterate by index, as handlers may register (and so grow the list) while we are dispatching
+		for (int j = 0; j < (int)eventRegistrations[eventType].size(); j++)
+		{
+			HandlerRegistration& registration = eventRegistrations[eventType][j];
+			if (!registration.active || registration.generation >= eventGeneration)
+			{
+				continue;
+			}
+
+			//only notify handler while replaying if handler is set to notify while replaying
+			if (replaying && !registration.handler->isSetToNotifyWhileReplaying())
+			{
+				continue;
+			}
+
+			//copy handler out first, as the registration reference may be invalidated by the handler registering others
+			EventHandler* handler = registration.handler;
+			HandlerStats* registrationStats = registration.stats;
+			notified = true;
+
+			//if handler conflicts with the wave (or is already in it), the wave has to finish before the handler can run
+			bool conflicting = handler->conflictsWith(waveReadProperties, waveWriteProperties);
+			for (int k = 0; k < waveTasksNum && !conflicting; k++)
+			{
+				conflicting = wave[k].handler == handler;
+			}
+			if (conflicting)
+			{
+				runWave();
+			}
+
+			//add handler to wave
+			if (waveTasksNum == (int)wave.size())
+			{
+				wave.push_back(DispatchTask());
+			}
+			wave[waveTasksNum].e = e;
+			wave[waveTasksNum].handler = handler;
+			wave[waveTasksNum].stats = registrationStats;
+			waveTasksNum++;
+
+			//handlers that haven't declared their accesses run on their own right away (they may register for events, etc.)
+			if (!handler->hasDeclaredPropertyAccess())
+			{
+				runWave();
+			}
+			else
+			{
+				waveReadProperties.insert(waveReadProperties.end(), handler->getReadProperties().begin(),
+					handler->getReadProperties().end());
+				waveWriteProperties.insert(waveWriteProperties.end(), handler->getWriteProperties().begin(),
+					handler->getWriteProperties().end());
+			}
+		}
+
+		if (notified)
+		{
+			stats.handled++;
+		}
+		else
+		{
+			countDropped(eventType, 1);
+		}
+	}
+
+	runWave();
+	dispatching = false;
+
+	//now that no list is being iterated, remove anything unregistered during dispatch
+	if (registrationsToCompact)
+	{
+		compactRegistrations();
+	}
+
+	//recycle handled events
+	for (int i = 0; i < eventsNum; i++)
+	{
+		releaseEvent(events[i]);
+	}
+}
+
+void EventManager::runWave()
+{
+	if (waveTasksNum == 1 || (waveTasksNum > 1 && workerPool == nullptr))
+	{
+		//nothing to run alongside, so just run on this thread (raising events directly)
+		for (int i = 0; i < waveTasksNum; i++)
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			wave[i].handler->onEvent(wave[i].e);
+			wave[i].stats->onEventDurations.record(nanosecondsBetween(start, std::chrono::steady_clock::now()));
+		}
+	}
+	else if (waveTasksNum > 1)
+	{
+		//run tasks in parallel, holding on to raised events so that they can be raised in the same order as if run one by one
+		workerPool->run(waveTasksNum, [this](int taskIndex)
+			{
+				DispatchTask& task = wave[taskIndex];
+				raisedEventsBuffer = &task.raisedEvents;
+				std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+				task.handler->onEvent(task.e);
+				task.onEventDuration = nanosecondsBetween(start, std::chrono::steady_clock::now());
+				raisedEventsBuffer = nullptr;
+			});
+
+		//record durations and raise held events from this thread, so that stats and queues are only touched here
+		for (int i = 0; i < waveTasksNum; i++)
+		{
+			wave[i].stats->onEventDurations.record(wave[i].onEventDuration);
+
+			int raisedEventsNum = wave[i].raisedEvents.size();
+			for (int j = 0; j < raisedEventsNum; j++)
+			{
+				enqueue(wave[i].raisedEvents[j]);
+			}
+			wave[i].raisedEvents.clear();
+		}
+	}
+
+	waveTasksNum = 0;
+	waveReadProperties.clear();
+	waveWriteProperties.clear();
+}
+
+void EventManager::compactRegistrations()
+{
+	int eventTypesNum = eventRegistrations.size();
+	for (int i = 0; i < eventTypesNum; i++)
+	{
+		std::vector<HandlerRegistration>& registrations = eventRegistrations[i];
+		int keptNum = 0;
+		int registrationsNum = registrations.size();
+		for (int j = 0; j < registrationsNum; j++)
+		{
+			if (registrations[j].active)
+			{
+				registrations[keptNum] = registrations[j];
+				keptNum++;
+			}
+		}
+		registrations.resize(keptNum);
+	}
+
+	registrationsToCompact = false;
+}
+
+float EventManager::getCurrentTime()
+{
+	return timeline->getTime();
+}
+
+bool EventManager::isPlayingReplay()
+{
+	return playingReplay;
+}
+
+void EventManager::setPlayingReplay(bool playingReplay)
+{
+	this->playingReplay = playingReplay;
+
+	//if we are now playing replay, record the replay start time unrelative to the speed
+	if (this->playingReplay)
+	{
+		replayStartTime = replayTimeline->getTime() * replayTimeline->getTic();
+	}
+}
+
+void EventManager::setReplayTimeline(Timeline* replayTimeline)
+{
+	this->replayTimeline = replayTimeline;
+}
+
+float EventManager::getReplayTime()
+{
+	return replayTimeline->getTime();
+}
+
+void EventManager::setReplaySpeed(float ticSize)
+{
+	replayTimeline->setTic(ticSize);
+}
+
+bool EventManager::isRegistered(int eventType, EventHandler* eventHandler)
+{
+	try
+	{
+		const std::vector<HandlerRegistration>& registrations = eventRegistrations.at(eventType);
+		int registrationsNum = registrations.size();
+		for (int i = 0; i < registrationsNum; i++)
+		{
+			if (registrations[i].active && registrations[i].handler == eventHandler)
+			{
+				return true;
+			}
+		}
+	}
+	catch (const std::out_of_range oor)
+	{
+		std::cerr << "No such event type: " + std::to_string(eventType) << std::endl;
+	}
+
+	return false;
+}
+
+void EventManager::dumpStats(std::ostream& out)
+{
+	std::chrono::duration<float> sinceStatsStart = std::chrono::steady_clock::now() - statsStartTime;
+	out << "Event stats over the last " << sinceStatsStart.count() << " s:" << std::endl;
+
+	out << "  queue depth: live " << eventQueueDepth.current << " (max " << eventQueueDepth.max << "), replay "
+		<< replayEventQueueDepth.current << " (max " << replayEventQueueDepth.max << "), ingress " << ingressQueueDepth.current
+		<< " (max " << ingressQueueDepth.max << "), behaviors " << behaviorQueueDepth.current << " (max "
+		<< behaviorQueueDepth.max << "); events in use " << getEventsInUse() << ", allocated " << getEventsAllocated()
+		<< std::endl;
+
+	//event types (skipping any with nothing to report)
+	std::lock_guard<std::mutex> guard(statsLock);
+	int eventTypesNum = eventTypeStats.size();
+	for (int i = 0; i < eventTypesNum; i++)
+	{
+		EventTypeStats& stats = eventTypeStats[i];
+		if (stats.raised == 0 && stats.handled == 0 && stats.dropped == 0)
+		{
+			continue;
+		}
+
+		out << "  " << eventTypeNames[i] << ": raised " << stats.raised << ", handled " << stats.handled << ", dropped "
+			<< stats.dropped << ", latency ";
+		printHistogram(out, stats.latency);
+		out << std::endl;
+	}
+
+	//handlers
+	for (std::map<EventHandler*, HandlerStats*>::iterator it = handlerStats.begin(); it != handlerStats.end(); it++)
+	{
+		if (it->second->onEventDurations.getCount() == 0)
+		{
+			continue;
+		}
+
+		out << "  " << it->second->name << " onEvent: ";
+		printHistogram(out, it->second->onEventDurations);
+		out << std::endl;
+	}
+}
+
+void EventManager::resetStats()
+{
+	std::lock_guard<std::mutex> guard(statsLock);
+	int eventTypesNum = eventTypeStats.size();
+	for (int i = 0; i < eventTypesNum; i++)
+	{
+		eventTypeStats[i].raised = 0;
+		eventTypeStats[i].handled = 0;
+		eventTypeStats[i].dropped = 0;
+		eventTypeStats[i].latency.reset();
+	}
+
+	for (std::map<EventHandler*, HandlerStats*>::iterator it = handlerStats.begin(); it != handlerStats.end(); it++)
+	{
+		it->second->onEventDurations.reset();
+	}
+
+	//queue depths start over from their current values
+	eventQueueDepth.max = eventQueueDepth.current;
+	replayEventQueueDepth.max = replayEventQueueDepth.current;
+	ingressQueueDepth.max = ingressQueueDepth.current;
+	behaviorQueueDepth.max = behaviorQueueDepth.current;
+
+	statsStartTime = std::chrono::steady_clock::now();
+}
+
+void EventManager::setStatsDumpInterval(float seconds)
+{
+	statsDumpInterval = seconds;
+}
@@ -1,170 +1,678 @@
-#pragma once
-#include <map>
-#include <queue>
-#include "Timeline.h"
-#include "Event.h"
-#include "EventHandler.h"
-
-/*
-* Singleton class used for managing an event system to coordinate functionality. Handlers can register to be notified when particular events
-* occur.
-*/
-class EventManager
-{
-	protected:
-		/*
-		* Comparator comparing events by their timestamps.
-		*/
-		class Compare
-		{
-			public:
-				bool operator() (Event* a, Event* b)
-				{
-					if (a->getTimestamp() > b->getTimestamp())
-					{
-						return true;
-					}
-
-					return false;
-				}
-		};
-
-	private:
-		/*
-		* Constructs an EventManager with the given list of possible event types and timeline.
-		*/
-		EventManager();
-
-		/* sole instance of EventManager */
-		static EventManager* manager;
-
-		/* map matching event types to their registered handlers */
-		std::map<std::string, std::vector<EventHandler*>> eventRegistrations;
-
-		/* queue of events organized by priority (lower timestamp = higher priority) */
-		std::priority_queue<Event*, std::vector<Event*>, Compare> eventQueue;
-
-		/* timeline used for timing handling of events */
-		Timeline* timeline;
-
-		/* whether the manager is currently playing a replay */
-		bool playingReplay;
-
-		/* timeline used for timing handling of events during a replay */
-		Timeline* replayTimeline;
-
-		/* queue of events for a replay */
-		std::priority_queue<Event*, std::vector<Event*>, Compare> replayEventQueue;
-
-		/* time at which replay started (unrelative to tic size so that it can be adjusted by current speed) */
-		float replayStartTime;
-
-	public:
-		/*
-		* Returns the sole instance of EventManager.
-		*/
-		static EventManager* getManager()
-		{
-			if (!manager)
-			{
-				manager = new EventManager();
-			}
-
-			return manager;
-		}
-
-		/*
-		* Sets manager's timeline to the given value.
-		* 
-		* timeline: timeline to set
-		*/
-		void setTimeline(Timeline* timeline);
-
-		/*
-		* Creates lists for the given event types in event registration.
-		* 
-		* eventTypes: event types
-		*/
-		void setEventTypes(std::vector<std::string> eventTypes);
-
-		/*
-		* Registers the handler for the given event type.
-		* 
-		* eventType: type of event being registered for
-		* eventHandler: handler registering for event
-		*/
-		void registerForEvent(std::string eventType, EventHandler* eventHandler);
-
-		/*
-		* Unregisters the handler for the given event type.
-		* 
-		* eventType: type of event being unregistered from
-		* eventHandler: handler unregistering from event
-		*/
-		void unregisterForEvent(std::string eventType, EventHandler* eventHandler);
-
-		/*
-		* Raises the given event by adding it to the event queue.
-		* 
-		* e: event to raise
-		*/
-		void raise(Event* e);
-
-		/*
-		* Handles events based on the current time.
-		*/
-		void handleEvents();
-
-		/*
-		* Retrieves the current time according to the manager's timeline.
-		* 
-		* returns: current time
-		*/
-		float getCurrentTime();
-
-		/*
-		* Returns indicating whether the manager is currently playing a replay.
-		* 
-		* returns: true if manager is playing a replay, false otherwise
-		*/
-		bool isPlayingReplay();
-
-		/*
-		* Sets whether the manager is currently playing a replay.
-		* 
-		* playingReplay: value indicating whether the manager is playing a replay
-		*/
-		void setPlayingReplay(bool playingReplay);
-
-		/*
-		* Sets the manager's replay timeline to the given value.
-		* 
-		* replayTimeline: timeline to use for replays
-		*/
-		void setReplayTimeline(Timeline* replayTimeline);
-
-		/*
-		* Retrieves the current time according to the replay timeline.
-		* 
-		* returns: current time according to replay timeline
-		*/
-		float getReplayTime();
-
-		/*
-		* Sets the replay speed by setting the tic size of the replay timeline to the given value.
-		* 
-		* ticSize: new tic size for replay timeline (controls speed of replay)
-		*/
-		void setReplaySpeed(float ticSize);
-
-		/*
-		* Returns indicating whether the given handler is registered for the given event type.
-		* 
-		* eventType: type of event
-		* eventHandler: handler to check
-		* 
-		* returns: true if handler is registered for the given event, and false otherwise
-		*/
-		bool isRegistered(std::string eventType, EventHandler* eventHandler);
-};
-
+#pragma once
+#include <map>
+#include <string>
+#include <vector>
+#include "Timeline.h"
+#include "Event.h"
+#include "EventHandler.h"
+#include "TimingWheel.h"
+#include "MpscQueue.h"
+#include "WorkerPool.h"
+#include "LatencyHistogram.h"
+#include "EventSchemas.h"
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+#include <cassert>
+#include <cstring>
+#include <chrono>
+#include <ostream>
+#include <coroutine>
+
+/*
+* Singleton class used for managing an event system to coordinate functionality. Handlers can register to be notified when particular events
+* occur.
+*/
+class EventManager
+{
+	protected:
+		/*
+		* Instrumentation kept for each event type.
+		*/
+		struct EventTypeStats
+		{
+			/* number of events raised */
+			unsigned long long raised;
+
+			/* number of events dispatched to at least one handler */
+			unsigned long long handled;
+
+			/* number of events thrown away without reaching a handler (ingress queue full, or no handler to notify) */
+			unsigned long long dropped;
+
+			/* time from each event being raised (or queued by another thread) to being dispatched, in nanoseconds */
+			LatencyHistogram latency;
+		};
+
+		/*
+		* Instrumentation kept for each registered handler.
+		*/
+		struct HandlerStats
+		{
+			/* name of the handler's class (only used for logging) */
+			std::string name;
+
+			/* time taken by each call to the handler's onEvent, in nanoseconds */
+			LatencyHistogram onEventDurations;
+		};
+
+		/*
+		* How to handle the payload of an event type, generated from its EventSchemas struct by registerEventSchema.
+		*/
+		struct EventSchema
+		{
+			/* size of the payload in bytes (0 if no schema has been registered for the type) */
+			int payloadSize;
+
+			/* writes the payload's fields as a string */
+			std::string (*payloadToString)(const void* payload);
+		};
+
+		/*
+		* Current and largest sampled depth of a queue.
+		*/
+		struct DepthGauge
+		{
+			int current;
+			int max;
+
+			void sample(int depth)
+			{
+				current = depth;
+				if (depth > max)
+				{
+					max = depth;
+				}
+			}
+		};
+
+		/*
+		* A handler's registration for an event type. Registrations are never erased while events are being dispatched; unregistering
+		* marks them inactive and they are compacted away once dispatch reaches a safe point.
+		*/
+		struct HandlerRegistration
+		{
+			/* handler to notify */
+			EventHandler* handler;
+
+			/* dispatch generation during which the handler registered (it is only notified of events dispatched after that) */
+			unsigned long long generation;
+
+			/* whether the registration is still in effect */
+			bool active;
+
+			/* instrumentation for the handler (shared by all of its registrations) */
+			HandlerStats* stats;
+		};
+
+		/*
+		* A single handler being notified of a single event, along with any events it raises (when run in parallel with other
+		* tasks, raised events are held here and raised in task order once all of the tasks have finished).
+		*/
+		struct DispatchTask
+		{
+			/* event being handled */
+			Event* e;
+
+			/* handler being notified */
+			EventHandler* handler;
+
+			/* events raised by the handler while handling the event */
+			std::vector<Event*> raisedEvents;
+
+			/* instrumentation for the handler */
+			HandlerStats* stats;
+
+			/* time taken by the handler's onEvent, in nanoseconds (recorded once the wave has finished) */
+			unsigned long long onEventDuration;
+		};
+
+		/*
+		* An event queued from another thread, waiting to be created and raised by the thread handling events.
+		*/
+		struct IngressEvent
+		{
+			/* type of the event */
+			int type;
+
+			/* payload of the event */
+			alignas(8) unsigned char payload[Event::MAX_PAYLOAD_SIZE];
+
+			/* size of the payload in bytes */
+			int payloadSize;
+
+			/* wall-clock time at which the event was queued */
+			std::chrono::steady_clock::time_point queuedAt;
+		};
+
+	private:
+		/*
+		* Constructs an EventManager with the given list of possible event types and timeline.
+		*/
+		EventManager();
+
+		/* sole instance of EventManager */
+		static EventManager* manager;
+
+		/* time covered by each slot of the event queues (one timeline unit, i.e. 1 ms for the server's timelines) */
+		static constexpr float EVENT_QUEUE_SLOT_SIZE = 1.f;
+
+		/* number of slots in the event queues (enough to cover events raised up to a second in the past or future) */
+		static const int EVENT_QUEUE_SLOTS_NUM = 2048;
+
+		/* maximum number of events other threads can queue between calls to handleEvents */
+		static const int INGRESS_QUEUE_CAPACITY = 4096;
+
+		/* registered handlers for each event type (indexed by event type id) */
+		std::vector<std::vector<HandlerRegistration>> eventRegistrations;
+
+		/* generation of the event currently being dispatched (incremented for each dispatched event) */
+		unsigned long long dispatchGeneration;
+
+		/* whether events are currently being dispatched to handlers */
+		bool dispatching;
+
+		/* pool used to run handlers with non-conflicting property accesses in parallel (null if there is only one core) */
+		WorkerPool* workerPool;
+
+		/* tasks in the wave currently being dispatched (only the first waveTasksNum are in use; the rest are kept for reuse) */
+		std::vector<DispatchTask> wave;
+
+		/* number of tasks in the current wave */
+		int waveTasksNum;
+
+		/* properties read by the tasks in the current wave */
+		std::vector<int> waveReadProperties;
+
+		/* properties written by the tasks in the current wave */
+		std::vector<int> waveWriteProperties;
+
+		/* events due in the current pass that are being dispatched */
+		std::vector<Event*> dueEvents;
+
+		/* handlers to notify at the end of each pass of event handling */
+		std::vector<EventHandler*> dispatchEndHandlers;
+
+		/* whether any registrations have been marked inactive and still need to be compacted */
+		bool registrationsToCompact;
+
+		/* name of each event type (indexed by event type id; only used for logging) */
+		std::vector<std::string> eventTypeNames;
+
+		/* payload schema of each event type (indexed by event type id) */
+		std::vector<EventSchema> eventSchemas;
+
+		/* queue of events scheduled by timestamp */
+		TimingWheel<Event*> eventQueue;
+
+		/* suspended behaviors, scheduled by the timestamp to resume them at */
+		TimingWheel<std::coroutine_handle<>> behaviorQueue;
+
+		/* lock protecting behaviorQueue (handlers running in parallel may start behaviors that suspend at the same time) */
+		std::mutex behaviorQueueLock;
+
+		/* behaviors due in the current pass that are being resumed */
+		std::vector<std::coroutine_handle<>> dueBehaviors;
+
+		/* timeline used for timing handling of events */
+		Timeline* timeline;
+
+		/* whether the manager is currently playing a replay (atomic as client threads check it before queueing input) */
+		std::atomic<bool> playingReplay;
+
+		/* timeline used for timing handling of events during a replay */
+		Timeline* replayTimeline;
+
+		/* queue of events for a replay (scheduled by timestamp relative to the start of the replay) */
+		TimingWheel<Event*> replayEventQueue;
+
+		/* time at which replay started (unrelative to tic size so that it can be adjusted by current speed) */
+		float replayStartTime;
+
+		/* handled events that are available to be reused by createEvent */
+		std::vector<Event*> freeEvents;
+
+		/* lock protecting the event pool (handlers running in parallel may create events at the same time) */
+		std::mutex poolLock;
+
+		/* total number of events the pool has had to allocate */
+		unsigned long long eventsAllocated;
+
+		/* number of events handed out by createEvent that have not yet been released */
+		int eventsInUse;
+
+		/* events queued by other threads to be raised at the start of the next handleEvents */
+		MpscQueue<IngressEvent> ingressQueue;
+
+		/* instrumentation for each event type (indexed by event type id) */
+		std::vector<EventTypeStats> eventTypeStats;
+
+		/* instrumentation for each registered handler */
+		std::map<EventHandler*, HandlerStats*> handlerStats;
+
+		/* lock protecting dropped event counts (events can be dropped by other threads when the ingress queue is full) */
+		std::mutex statsLock;
+
+		/* depth of the event queue at the start of each handleEvents */
+		DepthGauge eventQueueDepth;
+
+		/* depth of the replay event queue at the start of each handleEvents */
+		DepthGauge replayEventQueueDepth;
+
+		/* number of events drained from the ingress queue by each handleEvents */
+		DepthGauge ingressQueueDepth;
+
+		/* number of suspended behaviors at the start of each handleEvents */
+		DepthGauge behaviorQueueDepth;
+
+		/* how often (in seconds of wall-clock time) handleEvents prints stats (0 if it never does) */
+		float statsDumpInterval;
+
+		/* wall-clock time at which stats were last reset */
+		std::chrono::steady_clock::time_point statsStartTime;
+
+		/*
+		* Creates and raises every event queued by other threads. Events are stamped with the current time (or the start of the
+		* replay if one is playing) so that they are handled right away.
+		* 
+		* returns: number of events drained
+		*/
+		int drainIngressQueue();
+
+		/*
+		* Adds the event to the replay or regular event queue, depending on whether a replay is playing.
+		* 
+		* e: event to queue
+		*/
+		void enqueue(Event* e);
+
+		/*
+		* Writes a payload of the given schema as a string (used as an EventSchema's payloadToString).
+		*/
+		template <typename Payload>
+		static std::string writePayload(const void* payload)
+		{
+			Payload typedPayload;
+			memcpy(&typedPayload, payload, sizeof(Payload));
+			return EventSchemas::toString(typedPayload);
+		}
+
+		/*
+		* Counts the given number of events of the given type as dropped.
+		* 
+		* eventType: type of dropped events
+		* droppedNum: number of events dropped
+		*/
+		void countDropped(int eventType, int droppedNum);
+
+		/*
+		* Notifies the handlers registered for each of the given events, in order, and then recycles the events. Consecutive
+		* (event, handler) pairs are grouped into waves as long as the handlers' declared property accesses don't conflict, and
+		* each wave is run in parallel on the worker pool; a conflicting pair starts a new wave, so any two handlers touching the
+		* same property still run in timestamp order. Handlers that register or unregister during dispatch take effect starting
+		* with the next event.
+		* 
+		* events: events to dispatch, in the order they were popped
+		* replaying: whether the events are part of a replay (in which case only handlers set to notify while replaying are notified)
+		*/
+		void dispatch(std::vector<Event*>& events, bool replaying);
+
+		/*
+		* Pops every event from the given queue that is due at the given time into dueEvents.
+		* 
+		* queue: queue to pop from
+		* time: current time for the queue
+		* 
+		* returns: true if any events were due, false otherwise
+		*/
+		bool popDueEvents(TimingWheel<Event*>& queue, float time);
+
+		/*
+		* Calls onDispatchEnd for each handler registered for it.
+		*/
+		void notifyDispatchEnd();
+
+		/*
+		* Schedules the suspended behavior to be resumed at the given time. Safe to call from handlers running in parallel.
+		* 
+		* timestamp: time at which to resume the behavior
+		* behavior: behavior to resume
+		*/
+		void scheduleBehavior(float timestamp, std::coroutine_handle<> behavior);
+
+		/*
+		* Resumes every suspended behavior that is due at the given time (any that suspend again are rescheduled).
+		* 
+		* time: current time
+		* 
+		* returns: true if any behaviors were resumed, false otherwise
+		*/
+		bool resumeDueBehaviors(float time);
+
+		/*
+		* Runs all tasks in the current wave (in parallel if there are several) and then raises the events they raised in task
+		* order, before clearing the wave.
+		*/
+		void runWave();
+
+		/*
+		* Removes all inactive registrations. Must not be called while dispatching.
+		*/
+		void compactRegistrations();
+
+	public:
+		/*
+		* Awaitable returned by waitFor, which suspends the awaiting behavior until its time comes.
+		*/
+		class Wait
+		{
+			private:
+				/* time at which to resume the behavior */
+				float timestamp;
+
+			public:
+				Wait(float timestamp)
+				{
+					this->timestamp = timestamp;
+				}
+
+				bool await_ready()
+				{
+					return false;
+				}
+
+				void await_suspend(std::coroutine_handle<> behavior)
+				{
+					EventManager::getManager()->scheduleBehavior(timestamp, behavior);
+				}
+
+				void await_resume()
+				{
+				}
+		};
+
+		/*
+		* Returns the sole instance of EventManager.
+		*/
+		static EventManager* getManager()
+		{
+			if (!manager)
+			{
+				manager = new EventManager();
+			}
+
+			return manager;
+		}
+
+		/*
+		* Sets manager's timeline to the given value.
+		* 
+		* timeline: timeline to set
+		*/
+		void setTimeline(Timeline* timeline);
+
+		/*
+		* Creates lists for the given event types in event registration. Event type ids should be small non-negative integers,
+		* as they are used to directly index the lists of registered handlers.
+		* 
+		* eventTypes: map of event type ids to their names
+		*/
+		void setEventTypes(std::map<int, std::string> eventTypes);
+
+		/*
+		* Registers the given EventSchemas struct as the payload of every event type (already set with setEventTypes) that it
+		* declares itself the payload of.
+		*/
+		template <typename Payload>
+		void registerEventSchema()
+		{
+			static_assert(std::is_trivially_copyable<Payload>::value, "event payloads are copied bytewise");
+			static_assert(sizeof(Payload) <= Event::MAX_PAYLOAD_SIZE, "event payload is larger than Event::MAX_PAYLOAD_SIZE");
+
+			int eventTypesNum = eventSchemas.size();
+			for (int i = 0; i < eventTypesNum; i++)
+			{
+				if (Payload::isPayloadOf(i))
+				{
+					eventSchemas[i].payloadSize = sizeof(Payload);
+					eventSchemas[i].payloadToString = &writePayload<Payload>;
+				}
+			}
+		}
+
+		/*
+		* Returns the fields of a payload of the given event type as a string, using the type's registered schema.
+		* 
+		* eventType: id of event type
+		* payload: payload to write
+		* 
+		* returns: payload fields separated by spaces (or empty string if the type has no registered schema)
+		*/
+		std::string payloadToString(int eventType, const void* payload);
+
+		/*
+		* Returns the name of the given event type.
+		* 
+		* eventType: id of event type
+		* 
+		* returns: name of event type (or empty string if no such type exists)
+		*/
+		std::string getEventTypeName(int eventType);
+
+		/*
+		* Registers the handler for the given event type. If called while an event is being dispatched, the handler will not be
+		* notified of that event.
+		* 
+		* eventType: type of event being registered for
+		* eventHandler: handler registering for event
+		*/
+		void registerForEvent(int eventType, EventHandler* eventHandler);
+
+		/*
+		* Registers the handler to have its onDispatchEnd called at the end of each pass of event handling.
+		* 
+		* eventHandler: handler to register
+		*/
+		void registerForDispatchEnd(EventHandler* eventHandler);
+
+		/*
+		* Unregisters the handler for the given event type. If called while an event is being dispatched, the handler will not be
+		* notified of any further events, including the rest of that event's dispatch.
+		* 
+		* eventType: type of event being unregistered from
+		* eventHandler: handler unregistering from event
+		*/
+		void unregisterForEvent(int eventType, EventHandler* eventHandler);
+
+		/*
+		* Returns an event with the given values, reusing a previously released event if one is available. Events are owned by
+		* the manager: once raised, an event is released automatically after it has been handled, so handlers should copy any
+		* event they need to keep (see ReplayHandler). Must only be called from the thread handling events; other threads should use
+		* queueEvent instead.
+		* 
+		* timestamp: time at which the event should be handled
+		* type: type of the event
+		* payload: payload of the event (the EventSchemas struct for its type)
+		* 
+		* returns: event to raise
+		*/
+		template <typename Payload>
+		Event* createEvent(float timestamp, int type, const Payload& payload)
+		{
+			static_assert(std::is_trivially_copyable<Payload>::value, "event payloads are copied bytewise");
+			static_assert(sizeof(Payload) <= Event::MAX_PAYLOAD_SIZE, "event payload is larger than Event::MAX_PAYLOAD_SIZE");
+			assert(Payload::isPayloadOf(type));
+
+			return createEvent(timestamp, type, &payload, sizeof(Payload));
+		}
+
+		/*
+		* Returns an event with the given values, copying the payload from existing storage (such as another event's). Otherwise
+		* the same as the other createEvent.
+		* 
+		* timestamp: time at which the event should be handled
+		* type: type of the event
+		* payload: payload of the event
+		* payloadSize: size of payload in bytes
+		* 
+		* returns: event to raise
+		*/
+		Event* createEvent(float timestamp, int type, const void* payload, int payloadSize);
+
+		/*
+		* Returns the given event to the pool so that it can be reused. Only needed for events that are created but never raised.
+		* 
+		* e: event to release
+		*/
+		void releaseEvent(Event* e);
+
+		/*
+		* Returns the total number of events the pool has had to allocate. Stays flat once the pool has grown to fit the
+		* number of events alive at once.
+		* 
+		* returns: number of events allocated
+		*/
+		unsigned long long getEventsAllocated();
+
+		/*
+		* Returns the number of events currently created but not yet released (queued, being handled, or held for a replay).
+		* 
+		* returns: number of events in use
+		*/
+		int getEventsInUse();
+
+		/*
+		* Raises the given event by adding it to the event queue. The event should have been created by createEvent.
+		* 
+		* e: event to raise
+		*/
+		void raise(Event* e);
+
+		/*
+		* Queues an event to be raised at the start of the next handleEvents. Unlike createEvent and raise, this is safe to call
+		* from any thread and never blocks.
+		* 
+		* type: type of the event
+		* payload: payload of the event (the EventSchemas struct for its type)
+		* 
+		* returns: true if the event was queued, false if the queue is full
+		*/
+		template <typename Payload>
+		bool queueEvent(int type, const Payload& payload)
+		{
+			static_assert(std::is_trivially_copyable<Payload>::value, "event payloads are copied bytewise");
+			static_assert(sizeof(Payload) <= Event::MAX_PAYLOAD_SIZE, "event payload is larger than Event::MAX_PAYLOAD_SIZE");
+			assert(Payload::isPayloadOf(type));
+
+			return queueEvent(type, &payload, sizeof(Payload));
+		}
+
+		/*
+		* Queues an event with a payload copied from existing storage. Otherwise the same as the other queueEvent.
+		* 
+		* type: type of the event
+		* payload: payload of the event
+		* payloadSize: size of payload in bytes
+		* 
+		* returns: true if the event was queued, false if the queue is full
+		*/
+		bool queueEvent(int type, const void* payload, int payloadSize);
+
+		/*
+		* Returns an awaitable that suspends the behavior awaiting it for the given amount of time on the manager's timeline, e.g.
+		* co_await EventManager::getManager()->waitFor(100.f). The behavior is resumed by handleEvents once that time has come
+		* (along with the events due then), but not while a replay is playing.
+		* 
+		* delay: amount of time to wait
+		* 
+		* returns: awaitable to co_await
+		*/
+		Wait waitFor(float delay);
+
+		/*
+		* Returns the number of behaviors currently suspended waiting for their time to come.
+		* 
+		* returns: number of waiting behaviors
+		*/
+		int getBehaviorsWaiting();
+
+		/*
+		* Handles events based on the current time, after first raising any events queued by other threads. Behaviors waiting
+		* for the current time are resumed as part of this too.
+		*/
+		void handleEvents();
+
+		/*
+		* Retrieves the current time according to the manager's timeline.
+		* 
+		* returns: current time
+		*/
+		float getCurrentTime();
+
+		/*
+		* Returns indicating whether the manager is currently playing a replay.
+		* 
+		* returns: true if manager is playing a replay, false otherwise
+		*/
+		bool isPlayingReplay();
+
+		/*
+		* Sets whether the manager is currently playing a replay.
+		* 
+		* playingReplay: value indicating whether the manager is playing a replay
+		*/
+		void setPlayingReplay(bool playingReplay);
+
+		/*
+		* Sets the manager's replay timeline to the given value.
+		* 
+		* replayTimeline: timeline to use for replays
+		*/
+		void setReplayTimeline(Timeline* replayTimeline);
+
+		/*
+		* Retrieves the current time according to the replay timeline.
+		* 
+		* returns: current time according to replay timeline
+		*/
+		float getReplayTime();
+
+		/*
+		* Sets the replay speed by setting the tic size of the replay timeline to the given value.
+		* 
+		* ticSize: new tic size for replay timeline (controls speed of replay)
+		*/
+		void setReplaySpeed(float ticSize);
+
+		/*
+		* Returns indicating whether the given handler is registered for the given event type.
+		* 
+		* eventType: type of event
+		* eventHandler: handler to check
+		* 
+		* returns: true if handler is registered for the given event, and false otherwise
+		*/
+		bool isRegistered(int eventType, EventHandler* eventHandler);
+
+		/*
+		* Prints the stats gathered since they were last reset: raised/handled/dropped counts and raise-to-dispatch latency for
+		* each event type, onEvent durations for each handler, and queue depths. Must only be called from the thread handling events.
+		* 
+		* out: stream to print to
+		*/
+		void dumpStats(std::ostream& out);
+
+		/*
+		* Clears all gathered stats. Must only be called from the thread handling events.
+		*/
+		void resetStats();
+
+		/*
+		* Sets how often handleEvents prints stats to standard output (resetting them after each print, so each print covers the time
+		* since the last).
+		* 
+		* seconds: wall-clock time between prints (0 to never print)
+		*/
+		void setStatsDumpInterval(float seconds);
+};
+
@@ -0,0 +1,298 @@
+#pragma once
+#include "ClientServerConsts.h"
+#include <string>
+#include <sstream>
+#include <limits>
+
+/*
+* Namespace defining the payload carried by each type of event (and by messages sent between server and clients). Each payload is a
+* plain struct stored unboxed inside its Event, so handlers read typed fields directly instead of unpacking arguments by position.
+* 
+* Every payload declares which event types carry it (isPayloadOf) and lists its fields in order (forEachField). Everything that
+* turns payloads into text and back (event logging, replay logs, and the wire protocol) is generated from forEachField, so adding a
+* field to a payload is the only change needed to send it.
+*/
+namespace EventSchemas
+{
+	/*
+	* Payload of events that carry no arguments.
+	*/
+	struct NoArguments
+	{
+		static bool isPayloadOf(int eventType)
+		{
+			return eventType == ClientServerConsts::CLIENT_DISCONNECT_EVENT
+				|| eventType == ClientServerConsts::REPLAY_RECORDING_START_EVENT;
+		}
+
+		template <typename Visitor>
+		void forEachField(Visitor&)
+		{
+			//no fields to visit
+		}
+	};
+
+	/*
+	* Payload of a user input event (also sent from client to server, after the user input event code).
+	*/
+	struct UserInput
+	{
+		int characterId;
+		int keyType;
+
+		static bool isPayloadOf(int eventType)
+		{
+			return eventType == ClientServerConsts::USER_INPUT_EVENT;
+		}
+
+		template <typename Visitor>
+		void forEachField(Visitor& visitor)
+		{
+			visitor(characterId);
+			visitor(keyType);
+		}
+	};
+
+	/*
+	* Payload of a character collision event.
+	*/
+	struct CharacterCollision
+	{
+		int characterId;
+		int collidingObjectId;
+
+		static bool isPayloadOf(int eventType)
+		{
+			return eventType == ClientServerConsts::CHARACTER_COLLISION_EVENT;
+		}
+
+		template <typename Visitor>
+		void forEachField(Visitor& visitor)
+		{
+			visitor(characterId);
+			visitor(collidingObjectId);
+		}
+	};
+
+	/*
+	* Payload of events marking a change in a character's state (dying, or starting, continuing, or ending a jump or fall).
+	*/
+	struct CharacterStateChange
+	{
+		int characterId;
+
+		static bool isPayloadOf(int eventType)
+		{
+			return eventType == ClientServerConsts::CHARACTER_DEATH_EVENT
+				|| eventType == ClientServerConsts::CHARACTER_JUMP_START_EVENT
+				|| eventType == ClientServerConsts::CHARACTER_STILL_JUMPING_EVENT
+				|| eventType == ClientServerConsts::CHARACTER_JUMP_END_EVENT
+				|| eventType == ClientServerConsts::CHARACTER_FALL_START_EVENT
+				|| eventType == ClientServerConsts::CHARACTER_STILL_FALLING_EVENT
+				|| eventType == ClientServerConsts::CHARACTER_FALL_END_EVENT;
+		}
+
+		template <typename Visitor>
+		void forEachField(Visitor& visitor)
+		{
+			visitor(characterId);
+		}
+	};
+
+	/*
+	* Payload of a character spawn event.
+	*/
+	struct CharacterSpawn
+	{
+		int characterId;
+		int locationInSpaceId;
+		float absoluteX;
+		float absoluteY;
+
+		static bool isPayloadOf(int eventType)
+		{
+			return eventType == ClientServerConsts::CHARACTER_SPAWN_EVENT;
+		}
+
+		template <typename Visitor>
+		void forEachField(Visitor& visitor)
+		{
+			visitor(characterId);
+			visitor(locationInSpaceId);
+			visitor(absoluteX);
+			visitor(absoluteY);
+		}
+	};
+
+	/*
+	* Payload of events for an object moving (a platform, or a character for any reason).
+	*/
+	struct Movement
+	{
+		int objectId;
+		int locationInSpaceId;
+		float xMoved;
+		float yMoved;
+		float absoluteX;
+		float absoluteY;
+
+		static bool isPayloadOf(int eventType)
+		{
+			return eventType == ClientServerConsts::PLATFORM_MOVED_EVENT
+				|| eventType == ClientServerConsts::CHARACTER_MOVED_EVENT
+				|| eventType == ClientServerConsts::CHARACTER_MOVED_BY_GRAVITY_EVENT
+				|| eventType == ClientServerConsts::CHARACTER_MOVED_BY_PLATFORM_EVENT
+				|| eventType == ClientServerConsts::CHARACTER_NET_MOVED_EVENT;
+		}
+
+		template <typename Visitor>
+		void forEachField(Visitor& visitor)
+		{
+			visitor(objectId);
+			visitor(locationInSpaceId);
+			visitor(xMoved);
+			visitor(yMoved);
+			visitor(absoluteX);
+			visitor(absoluteY);
+		}
+	};
+
+	/*
+	* Payload of a replay recording stop event.
+	*/
+	struct ReplayRecordingStop
+	{
+		float replaySpeed;
+
+		static bool isPayloadOf(int eventType)
+		{
+			return eventType == ClientServerConsts::REPLAY_RECORDING_STOP_EVENT;
+		}
+
+		template <typename Visitor>
+		void forEachField(Visitor& visitor)
+		{
+			visitor(replaySpeed);
+		}
+	};
+
+	/*
+	* Positional update published from server to clients (not carried by any event).
+	*/
+	struct PositionUpdate
+	{
+		int objectId;
+		int locationInSpaceId;
+		float absoluteX;
+		float absoluteY;
+
+		static bool isPayloadOf(int)
+		{
+			return false;
+		}
+
+		template <typename Visitor>
+		void forEachField(Visitor& visitor)
+		{
+			visitor(objectId);
+			visitor(locationInSpaceId);
+			visitor(absoluteX);
+			visitor(absoluteY);
+		}
+	};
+
+	/*
+	* Writes each field it visits to a stream, separated by spaces. Floats are written with enough digits to be read back exactly.
+	*/
+	struct FieldWriter
+	{
+		std::ostream& out;
+		bool first;
+
+		template <typename T>
+		void operator()(T& field)
+		{
+			if (!first)
+			{
+				out << ' ';
+			}
+			first = false;
+			out << field;
+		}
+	};
+
+	/*
+	* Reads each field it visits from a stream, in order.
+	*/
+	struct FieldReader
+	{
+		std::istream& in;
+
+		template <typename T>
+		void operator()(T& field)
+		{
+			in >> field;
+		}
+	};
+
+	/*
+	* Writes the payload's fields to the stream, separated by spaces.
+	* 
+	* out: stream to write to
+	* payload: payload to write
+	*/
+	template <typename Payload>
+	void write(std::ostream& out, Payload payload)
+	{
+		std::streamsize oldPrecision = out.precision(std::numeric_limits<float>::max_digits10);
+		FieldWriter writer = { out, true };
+		payload.forEachField(writer);
+		out.precision(oldPrecision);
+	}
+
+	/*
+	* Reads the payload's fields from the stream, in the order written by write.
+	* 
+	* in: stream to read from
+	* payload: payload to fill in
+	* 
+	* returns: true if every field was read, false otherwise
+	*/
+	template <typename Payload>
+	bool read(std::istream& in, Payload& payload)
+	{
+		FieldReader reader = { in };
+		payload.forEachField(reader);
+		return !in.fail();
+	}
+
+	/*
+	* Returns the payload's fields as a string, separated by spaces.
+	* 
+	* payload: payload to convert
+	* 
+	* returns: string representation of payload
+	*/
+	template <typename Payload>
+	std::string toString(Payload payload)
+	{
+		std::ostringstream out;
+		write(out, payload);
+		return out.str();
+	}
+
+	/*
+	* Fills in the payload from a string created by toString.
+	* 
+	* payloadString: string to read from
+	* payload: payload to fill in
+	* 
+	* returns: true if every field was read, false otherwise
+	*/
+	template <typename Payload>
+	bool fromString(const std::string& payloadString, Payload& payload)
+	{
+		std::istringstream in(payloadString);
+		return read(in, payload);
+	}
+}
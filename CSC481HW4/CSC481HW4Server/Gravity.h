@@ -1,130 +1,169 @@
-#pragma once
-#include "Property.h"
-#include "Timeline.h"
-
-/*
-* Property defining the gravity of an object, which means that it will fall down if not standing on another object or jumping up.
-* 
-* Property Dependencies: LocationInSpace, Collision
-*/
-class Gravity :
-    public Property
-{
-    private:
-        /* timeline used for timing movements due to falling down */
-        Timeline* timeline;
-
-        /* LocationInSpace corresponding to each object*/
-        std::map<int, int> locationsInSpace;
-
-        /* Collision corresponding to each object */
-        std::map<int, int> collisions;
-
-        /* values indicating whether objects are jumping up */
-        std::map<int, bool> jumpingUpValues;
-
-        /* values indicating whether objects are falling down */
-        std::map<int, bool> fallingDownValues;
-
-        /* values indicating whether objects are currently on an object (and thus neither jumping or falling) */
-        std::map<int, bool> standingOnObjectsValues;
-
-        /* list of collisions to check for each object to determine whether object has stopped falling */
-        std::map<int, std::vector<int>> collisionsToCheck;
-
-        /* object each object is standing on (if any) */
-        std::map<int, int> objectsStoodOn;
-
-        /* time spent for each object on movement (used for falling down) */
-        std::map<int, float> velocities;
-
-    public:
-        /*
-        * Constructs a Gravity property using the given values.
-        * 
-        * id: id of property
-        * propertyMap: map of all properties
-        * timeline: timeline to use in timing falling movements
-        */
-        Gravity(int id, std::map<int, Property*>* propertyMap, Timeline* timeline);
-
-        /*
-        * Adds an object to the property with the given values. The object should initially be standing on something and neither
-        * jumping up nor falling down.
-        * 
-        * objectId: id of object
-        * locationInSpaceId: id of corresponding LocationInSpace
-        * collisionId: id of corresponding Collision
-        * collisionsToCheck: list of Collision properties to check for this object when determining whether it is standing
-        * objectStandingOn: object that the added object is currently standing/resting on
-        * 
-        */
-        void addObject(int objectId, int locationInSpaceId, int collisionId, 
-            std::vector<int> collisionsToCheck, int objectStandingOn, float velocity);
-
-        /*
-        * Removes the given object from the property.
-        * 
-        * objectId: id of object
-        */
-        void removeObject(int objectId);
-
-        /*
-        * Returns indicating whether the object is jumping up.
-        * 
-        * objectId: id of object
-        * 
-        * returns: true if object is jumping up, false otherwise
-        */
-        bool isJumpingUp(int objectId);
-
-        /*
-        * Sets whether the object is jumping up.
-        * 
-        * objectId: id of object
-        * jumpingUp: whether object is jumping
-        */
-        void setJumpingUp(int objectId, bool jumpingUp);
-
-        /*
-        * Returns whether the object is falling down.
-        * 
-        * objectId: id of object
-        * 
-        * returns: true if object is falling, false otherwise
-        */
-        bool getFallingDown(int objectId);
-
-        /*
-        * Returns whether the object is standing on another object.
-        * 
-        * objectId: id of object
-        * 
-        * returns: true if object is standing/resting, false otherwise
-        */
-        bool isStanding(int objectId);
-
-        /*
-        * Returns id of object that the given object is standing on (if any).
-        * 
-        * objectId: id of object
-        * 
-        * returns: id of object that given object is standing on (or -1 if none).
-        */
-        int objectStandingOn(int objectId);
-
-        /*
-        * Processes any gravity adjustments for the given object. An object may either be jumping, falling down, starting to fall down,
-        * no longer falling down, or standing on another object (and thus at rest).
-        * 
-        * objectId: id of object
-        */
-        void processGravity(int objectId);
-
-        /*
-        * Processes any gravity adjustments for all objects. An object may either be jumping, falling down, starting to fall down,
-        * no longer falling down, or standing on another object (and thus at rest).
-        */
-        void processGravityForAll();
-};
-
+#pragma once
+#include "Property.h"
+#include "Timeline.h"
+
+/*
+* Property defining the gravity of an object, which means that it will fall down if not standing on another object or jumping up.
+* 
+* Property Dependencies: LocationInSpace, Collision
+*/
+class Gravity :
+    public Property
+{
+    private:
+        /* timeline used for timing movements due to falling down */
+        Timeline* timeline;
+
+        /* LocationInSpace corresponding to each object (this and the arrays below are indexed the same as objects) */
+        std::vector<int> locationsInSpace;
+
+        /* Collision corresponding to each object */
+        std::vector<int> collisions;
+
+        /* values indicating whether objects are jumping up */
+        std::vector<char> jumpingUpValues;
+
+        /* values indicating whether objects are falling down */
+        std::vector<char> fallingDownValues;
+
+        /* values indicating whether objects are currently on an object (and thus neither jumping or falling) */
+        std::vector<char> standingOnObjectsValues;
+
+        /* list of collisions to check for each object to determine whether object has stopped falling */
+        std::vector<std::vector<int>> collisionsToCheck;
+
+        /* object each object is standing on (if any) */
+        std::vector<int> objectsStoodOn;
+
+        /* time spent for each object on movement (used for falling down) */
+        std::vector<float> velocities;
+
+        /* time at which each object finishes its last movement and is ready to make another */
+        std::vector<float> readyTimes;
+
+        /*
+        * Processes any gravity adjustments for the object at the given index.
+        * 
+        * index: index of object
+        */
+        void processGravityAt(int index);
+
+    public:
+        /*
+        * Constructs a Gravity property using the given values.
+        * 
+        * id: id of property
+        * propertyRegistry: registry of all properties
+        * timeline: timeline to use in timing falling movements
+        */
+        Gravity(int id, PropertyRegistry* propertyRegistry, Timeline* timeline);
+
+        /*
+        * Adds an object to the property with the given values. The object should initially be standing on something and neither
+        * jumping up nor falling down.
+        * 
+        * objectId: id of object
+        * locationInSpaceId: id of corresponding LocationInSpace
+        * collisionId: id of corresponding Collision
+        * collisionsToCheck: list of Collision properties to check for this object when determining whether it is standing
+        * objectStandingOn: object that the added object is currently standing/resting on
+        * 
+        */
+        void addObject(int objectId, int locationInSpaceId, int collisionId, 
+            std::vector<int> collisionsToCheck, int objectStandingOn, float velocity);
+
+        /*
+        * Removes the given object from the property.
+        * 
+        * objectId: id of object
+        */
+        void removeObject(int objectId);
+
+        /*
+        * Returns indicating whether the object is jumping up.
+        * 
+        * objectId: id of object
+        * 
+        * returns: true if object is jumping up, false otherwise
+        */
+        bool isJumpingUp(int objectId);
+
+        /*
+        * Sets whether the object is jumping up.
+        * 
+        * objectId: id of object
+        * jumpingUp: whether object is jumping
+        */
+        void setJumpingUp(int objectId, bool jumpingUp);
+
+        /*
+        * Returns whether the object is falling down.
+        * 
+        * objectId: id of object
+        * 
+        * returns: true if object is falling, false otherwise
+        */
+        bool getFallingDown(int objectId);
+
+        /*
+        * Returns whether the object is standing on another object.
+        * 
+        * objectId: id of object
+        * 
+        * returns: true if object is standing/resting, false otherwise
+        */
+        bool isStanding(int objectId);
+
+        /*
+        * Returns id of object that the given object is standing on (if any).
+        * 
+        * objectId: id of object
+        * 
+        * returns: id of object that given object is standing on (or -1 if none).
+        */
+        int objectStandingOn(int objectId);
+
+        /*
+        * Returns whether the object at the given index (see Property::getObjectAt) is standing on another object.
+        * 
+        * index: index of object
+        * 
+        * returns: true if object is standing/resting, false otherwise
+        */
+        bool isStandingAt(int index);
+
+        /*
+        * Returns id of object that the object at the given index (see Property::getObjectAt) is standing on (if any).
+        * 
+        * index: index of object
+        * 
+        * returns: id of object that given object is standing on (or -1 if none).
+        */
+        int objectStandingOnAt(int index);
+
+        /*
+        * Returns how long until the object finishes its last movement (each movement due to falling takes the object's velocity in
+        * time, which should be waited out before processing gravity for it again).
+        * 
+        * objectId: id of object
+        * 
+        * returns: time left on the object's last movement, or 0 if it is ready to move
+        */
+        float getTimeUntilReady(int objectId);
+
+        /*
+        * Processes any gravity adjustments for the given object. An object may either be jumping, falling down, starting to fall down,
+        * no longer falling down, or standing on another object (and thus at rest). A movement due to falling doesn't wait for the
+        * time it takes; instead the object is not ready to move again until that time has passed (see getTimeUntilReady).
+        * 
+        * objectId: id of object
+        */
+        void processGravity(int objectId);
+
+        /*
+        * Processes any gravity adjustments for all objects. An object may either be jumping, falling down, starting to fall down,
+        * no longer falling down, or standing on another object (and thus at rest).
+        */
+        void processGravityForAll();
+};
+
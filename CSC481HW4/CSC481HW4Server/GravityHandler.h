@@ -1,40 +1,79 @@
-#pragma once
-#include "EventHandler.h"
-#include "ClientServerConsts.h"
-#include "Gravity.h"
-#include "LocationInSpace.h"
-#include "EventManager.h"
-
-/*
-* An EventHandler that handles changes to a character based on gravity.
-*/
-class GravityHandler :
-    public EventHandler
-{
-    private:
-        /* id of Gravity property to use for performing checks on character */
-        int gravityId;
-
-        /* id of LocationInSpace property to use in checking character positions*/
-        int locationInSpaceId;
-
-    public:
-        /*
-        * Constructs a GravityHandler with the given values.
-        * 
-        * propertyMap: map of all properties
-        * notifyWhileReplaying: whether to notify this handler of events while a replay is being played
-        * gravityId: id of gravity to use in performing checks on characters
-        * locationInSpaceId: id of LocationInSpace to use in checking character positions
-        */
-        GravityHandler(std::map<int, Property*>* propertyMap, bool notifyWhileReplaying,
-            int gravityId, int locationInSpaceId);
-
-        /*
-        * Handles processing gravity based on the given event.
-        *
-        * e: event being handled
-        */
-        void onEvent(Event* e);
-};
-
+#pragma once
+#include "EventHandler.h"
+#include "ClientServerConsts.h"
+#include "Gravity.h"
+#include "LocationInSpace.h"
+#include "EventManager.h"
+#include "Behavior.h"
+
+/*
+* An EventHandler that handles changes to a character based on gravity.
+*/
+class GravityHandler :
+    public EventHandler
+{
+    private:
+        /* id of Gravity property to use for performing checks on character */
+        int gravityId;
+
+        /* id of LocationInSpace property to use in checking character positions*/
+        int locationInSpaceId;
+
+        /* Gravity property (resolved from gravityId at construction) */
+        Gravity* gravity;
+
+        /* LocationInSpace property (resolved from locationInSpaceId at construction) */
+        LocationInSpace* locationInSpace;
+
+        /* number of falls started by each character (used to tell whether a fall behavior is still the current one) */
+        std::map<int, unsigned long long> fallNums;
+
+        /* time waited between steps of a fall */
+        static constexpr float FALL_STEP_DELAY = 100.f;
+
+        /*
+        * Returns whether the given fall is still being performed by the character.
+        * 
+        * characterId: id of character
+        * fallNum: number of the fall
+        * 
+        * returns: true if the character still exists and is falling in the given fall, false otherwise
+        */
+        bool isCurrentFall(int characterId, unsigned long long fallNum);
+
+        /*
+        * Processes gravity for the character and raises the resulting events. Starts a fall behavior if the character has just
+        * started falling.
+        * 
+        * characterId: id of character
+        */
+        void applyGravity(int characterId);
+
+        /*
+        * Carries out the rest of a fall that the character just started, one step at a time, until the character stops falling.
+        * 
+        * characterId: id of character
+        * fallNum: number of the fall
+        */
+        Behavior performFall(int characterId, unsigned long long fallNum);
+
+    public:
+        /*
+        * Constructs a GravityHandler with the given values.
+        * 
+        * propertyRegistry: registry of all properties
+        * notifyWhileReplaying: whether to notify this handler of events while a replay is being played
+        * gravityId: id of gravity to use in performing checks on characters
+        * locationInSpaceId: id of LocationInSpace to use in checking character positions
+        */
+        GravityHandler(PropertyRegistry* propertyRegistry, bool notifyWhileReplaying,
+            int gravityId, int locationInSpaceId);
+
+        /*
+        * Handles processing gravity based on the given event.
+        *
+        * e: event being handled
+        */
+        void onEvent(Event* e);
+};
+
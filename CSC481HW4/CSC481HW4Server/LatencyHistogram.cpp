@@ -0,0 +1,141 @@
+#include "LatencyHistogram.h"
+#include <cmath>
+
+LatencyHistogram::LatencyHistogram()
+{
+	//values below 2^SUB_BUCKET_BITS each get their own bucket, then every power of two after that is split into
+	//SUB_BUCKETS_HALF_NUM buckets, up to the largest 64-bit value
+	counts.resize((64 - SUB_BUCKET_BITS + 2) * SUB_BUCKETS_HALF_NUM);
+	reset();
+}
+
+int LatencyHistogram::getBucketIndex(unsigned long long value)
+{
+	if (value < (1ULL << SUB_BUCKET_BITS))
+	{
+		return (int)value;
+	}
+
+	//find highest set bit, then drop enough low bits to leave SUB_BUCKET_BITS bits of precision
+	int highestBit = 0;
+	while ((value >> highestBit) > 1)
+	{
+		highestBit++;
+	}
+	int shift = highestBit - (SUB_BUCKET_BITS - 1);
+
+	return shift * SUB_BUCKETS_HALF_NUM + (int)(value >> shift);
+}
+
+unsigned long long LatencyHistogram::getBucketHighestValue(int index)
+{
+	if (index < (1 << SUB_BUCKET_BITS))
+	{
+		return index;
+	}
+
+	int shift = index / SUB_BUCKETS_HALF_NUM - 1;
+	unsigned long long subBucket = index % SUB_BUCKETS_HALF_NUM + SUB_BUCKETS_HALF_NUM;
+
+	return ((subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(unsigned long long value)
+{
+	counts[getBucketIndex(value)]++;
+	totalCount++;
+	sum += (double)value;
+
+	if (value < minValue)
+	{
+		minValue = value;
+	}
+	if (value > maxValue)
+	{
+		maxValue = value;
+	}
+}
+
+void LatencyHistogram::add(const LatencyHistogram& other)
+{
+	int bucketsNum = counts.size();
+	for (int i = 0; i < bucketsNum; i++)
+	{
+		counts[i] += other.counts[i];
+	}
+
+	totalCount += other.totalCount;
+	sum += other.sum;
+	if (other.minValue < minValue)
+	{
+		minValue = other.minValue;
+	}
+	if (other.maxValue > maxValue)
+	{
+		maxValue = other.maxValue;
+	}
+}
+
+void LatencyHistogram::reset()
+{
+	int bucketsNum = counts.size();
+	for (int i = 0; i < bucketsNum; i++)
+	{
+		counts[i] = 0;
+	}
+
+	totalCount = 0;
+	minValue = ~0ULL;
+	maxValue = 0;
+	sum = 0.0;
+}
+
+unsigned long long LatencyHistogram::getCount()
+{
+	return totalCount;
+}
+
+unsigned long long LatencyHistogram::getMin()
+{
+	return totalCount == 0 ? 0 : minValue;
+}
+
+unsigned long long LatencyHistogram::getMax()
+{
+	return maxValue;
+}
+
+double LatencyHistogram::getMean()
+{
+	return totalCount == 0 ? 0.0 : sum / totalCount;
+}
+
+unsigned long long LatencyHistogram::getValueAtPercentile(double percentile)
+{
+	if (totalCount == 0)
+	{
+		return 0;
+	}
+
+	//find the first bucket at which enough values have been counted
+	unsigned long long countAtPercentile = (unsigned long long)ceil(percentile / 100.0 * totalCount);
+	if (countAtPercentile < 1)
+	{
+		countAtPercentile = 1;
+	}
+
+	unsigned long long countSoFar = 0;
+	int bucketsNum = counts.size();
+	for (int i = 0; i < bucketsNum; i++)
+	{
+		countSoFar += counts[i];
+		if (countSoFar >= countAtPercentile)
+		{
+			//never report more than was actually recorded
+			unsigned long long value = getBucketHighestValue(i);
+			return value < maxValue ? value : maxValue;
+		}
+	}
+
+	return maxValue;
+}
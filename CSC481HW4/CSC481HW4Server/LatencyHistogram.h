@@ -0,0 +1,104 @@
+#pragma once
+#include <vector>
+
+/*
+* A histogram of non-negative integer values (such as durations in nanoseconds) in the style of an HdrHistogram. Values are
+* grouped into buckets whose width grows with the magnitude of the value, so every recorded value is kept to within about 1.5%
+* across the whole range while recording stays O(1) and the histogram never allocates after construction.
+*/
+class LatencyHistogram
+{
+	private:
+		/* number of bits of precision kept for each value (values below 2^SUB_BUCKET_BITS are recorded exactly) */
+		static const int SUB_BUCKET_BITS = 7;
+
+		/* number of buckets in each power-of-two range past the first */
+		static const int SUB_BUCKETS_HALF_NUM = 1 << (SUB_BUCKET_BITS - 1);
+
+		/* count of recorded values in each bucket */
+		std::vector<unsigned long long> counts;
+
+		/* number of recorded values */
+		unsigned long long totalCount;
+
+		/* smallest recorded value */
+		unsigned long long minValue;
+
+		/* largest recorded value */
+		unsigned long long maxValue;
+
+		/* sum of recorded values (used for the mean) */
+		double sum;
+
+		/*
+		* Returns the index of the bucket holding the given value.
+		*/
+		static int getBucketIndex(unsigned long long value);
+
+		/*
+		* Returns the largest value that falls in the bucket at the given index.
+		*/
+		static unsigned long long getBucketHighestValue(int index);
+
+	public:
+		/*
+		* Constructs an empty histogram.
+		*/
+		LatencyHistogram();
+
+		/*
+		* Records a value.
+		* 
+		* value: value to record
+		*/
+		void record(unsigned long long value);
+
+		/*
+		* Adds all of the values recorded in another histogram to this one.
+		* 
+		* other: histogram to add
+		*/
+		void add(const LatencyHistogram& other);
+
+		/*
+		* Removes all recorded values.
+		*/
+		void reset();
+
+		/*
+		* Returns the number of recorded values.
+		* 
+		* returns: number of recorded values
+		*/
+		unsigned long long getCount();
+
+		/*
+		* Returns the smallest recorded value.
+		* 
+		* returns: smallest value (or 0 if nothing has been recorded)
+		*/
+		unsigned long long getMin();
+
+		/*
+		* Returns the largest recorded value.
+		* 
+		* returns: largest value (or 0 if nothing has been recorded)
+		*/
+		unsigned long long getMax();
+
+		/*
+		* Returns the mean of the recorded values.
+		* 
+		* returns: mean value (or 0 if nothing has been recorded)
+		*/
+		double getMean();
+
+		/*
+		* Returns the value at or below which the given percentage of recorded values fall (to within the histogram's precision).
+		* 
+		* percentile: percentage between 0 and 100
+		* 
+		* returns: value at percentile (or 0 if nothing has been recorded)
+		*/
+		unsigned long long getValueAtPercentile(double percentile);
+};
@@ -1,62 +1,150 @@
-#include "LocationInSpace.h"
-#include <iostream>
-
-LocationInSpace::LocationInSpace(int id, std::map<int, Property*>* propertyMap) : Property(id, propertyMap)
-{
-	//construction taken care of in Property
-}
-
-void LocationInSpace::addObject(int id, sf::Shape* shape)
-{
-	if (hasObject(id))
-	{
-		std::cerr << "Cannot add duplicate object to LocationInSpace" << std::endl;
-		return;
-	}
-
-	objects.push_back(id);
-	objectShapes.insert(std::pair<int, sf::Shape*>(id, shape));
-}
-
-void LocationInSpace::removeObject(int id)
-{
-	if (!hasObject(id))
-	{
-		std::cerr << "No such object defined in LocationInSpace" << std::endl;
-		return;
-	}
-
-	//remove from objects list
-	int objectsNum = objects.size();
-	for (int i = 0; i < objectsNum; i++)
-	{
-		if (objects[i] == id)
-		{
-			objects.erase(objects.begin() + i);
-		}
-	}
-
-	//remove from shapes map
-	objectShapes.erase(id);
-}
-
-sf::Shape* LocationInSpace::getObjectShape(int id)
-{
-	sf::Shape* shapeToReturn;
-
-	try
-	{
-		shapeToReturn = objectShapes.at(id);
-	}
-	catch (std::out_of_range)
-	{
-		return nullptr;
-	}
-
-	return shapeToReturn;
-}
-
-std::vector<int> LocationInSpace::getObjects()
-{
-	return objects;
-}
+#include "LocationInSpace.h"
+#include <iostream>
+
+LocationInSpace::LocationInSpace(int id, PropertyRegistry* propertyRegistry) : Property(id, propertyRegistry)
+{
+	//construction taken care of in Property
+}
+
+void LocationInSpace::addObject(int id, Transform* transform)
+{
+	if (hasObject(id))
+	{
+		std::cerr << "Cannot add duplicate object to LocationInSpace" << std::endl;
+		return;
+	}
+
+	objects.insert(id);
+	objectTransforms.push_back(transform);
+	objectBounds.push_back(transform->getBounds());
+	touchedValues.push_back(false);
+	tickStartXs.push_back(transform->getX());
+	tickStartYs.push_back(transform->getY());
+	transform->setOwner(this, id);
+}
+
+void LocationInSpace::removeObject(int id)
+{
+	//remove from objects list
+	int index = objects.remove(id);
+	if (index < 0)
+	{
+		std::cerr << "No such object defined in LocationInSpace" << std::endl;
+		return;
+	}
+
+	//forget object's moves this tick (so it isn't listed twice if it's added back)
+	if (touchedValues[index])
+	{
+		int touchedNum = touchedObjects.size();
+		for (int i = 0; i < touchedNum; i++)
+		{
+			if (touchedObjects[i] == id)
+			{
+				touchedObjects.erase(touchedObjects.begin() + i);
+				break;
+			}
+		}
+	}
+
+	//stop transform from reporting moves
+	objectTransforms[index]->setOwner(nullptr, -1);
+
+	//remove from arrays (the last object takes the removed object's index, as in objects)
+	swapRemove(objectTransforms, index);
+	swapRemove(objectBounds, index);
+	swapRemove(touchedValues, index);
+	swapRemove(tickStartXs, index);
+	swapRemove(tickStartYs, index);
+}
+
+Transform* LocationInSpace::getObjectTransform(int id)
+{
+	int index = objects.indexOf(id);
+	if (index < 0)
+	{
+		return nullptr;
+	}
+
+	return objectTransforms[index];
+}
+
+Transform* LocationInSpace::getObjectTransformAt(int index)
+{
+	return objectTransforms[index];
+}
+
+void LocationInSpace::onObjectMoved(int id, float previousX, float previousY)
+{
+	int index = objects.indexOf(id);
+	if (index < 0)
+	{
+		return;
+	}
+
+	objectBounds[index] = objectTransforms[index]->getBounds();
+
+	//if this is the object's first move this tick, record where it started
+	if (!touchedValues[index])
+	{
+		touchedValues[index] = true;
+		tickStartXs[index] = previousX;
+		tickStartYs[index] = previousY;
+		touchedObjects.push_back(id);
+	}
+}
+
+const Transform::Bounds* LocationInSpace::getObjectBounds(int id)
+{
+	int index = objects.indexOf(id);
+	if (index < 0)
+	{
+		return nullptr;
+	}
+
+	return &objectBounds[index];
+}
+
+const Transform::Bounds& LocationInSpace::getObjectBoundsAt(int index)
+{
+	return objectBounds[index];
+}
+
+void LocationInSpace::beginTick()
+{
+	//only objects moved last tick need resetting
+	int touchedNum = touchedObjects.size();
+	for (int i = 0; i < touchedNum; i++)
+	{
+		touchedValues[objects.indexOf(touchedObjects[i])] = false;
+	}
+	touchedObjects.clear();
+}
+
+bool LocationInSpace::hasMovedThisTick(int id)
+{
+	int index = objects.indexOf(id);
+	if (index < 0)
+	{
+		std::cerr << "No such object defined in LocationInSpace" << std::endl;
+		return false;
+	}
+
+	return hasMovedThisTickAt(index);
+}
+
+bool LocationInSpace::hasMovedThisTickAt(int index)
+{
+	if (!touchedValues[index])
+	{
+		return false;
+	}
+
+	Transform* transform = objectTransforms[index];
+	return transform->getX() != tickStartXs[index] || transform->getY() != tickStartYs[index];
+}
+
+const std::vector<int>& LocationInSpace::getObjects()
+{
+	return objects.getIds();
+}
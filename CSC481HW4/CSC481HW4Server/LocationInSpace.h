@@ -1,59 +1,140 @@
-#pragma once
-#include "Property.h"
-#include <SFML/Graphics.hpp>
-#include <map>
-
-/*
-* Property defining an object's location in space (i.e. that an object has a particular location, size, etc.). The object's
-* location in space is represented using an sf::Shape. New objects can be added and their shapes retrieved.
-* 
-* Property Dependencies: none
-*/
-class LocationInSpace :
-    public Property
-{
-    private:
-        /* sfml shapes pertaining to each object with this property */
-        std::map<int, sf::Shape*> objectShapes;
-
-    public:
-        /*
-        * Constructs a LocationInSpace property instance with the given values.
-        * 
-        * id: id of the property
-        * propertyMap: map of all properties
-        */
-        LocationInSpace(int id, std::map<int, Property*>* propertyMap);
-
-        /*
-        * Adds an object to this property using the given shape to indicate its location in space.
-        * 
-        * id: id of object to add
-        * shape: shape used to represent object's location in space (size, position, etc.)
-        */
-        void addObject(int id, sf::Shape* shape);
-
-        /*
-        * Removes an object from this property to undefine its location in space.
-        * 
-        * id: id of object to remove
-        */
-        void removeObject(int id);
-
-        /*
-        * Returns a pointer to the shape corresponding to the given object.
-        * 
-        * id: id of object to retrieve shape of
-        * 
-        * returns: pointer to shape representing object's location in space
-        */
-        sf::Shape* getObjectShape(int id);
-
-        /*
-        * Returns property's list of objects. Allows for obtaining ids/locations of individual objects.
-        *
-        * returns: list of objects
-        */
-        std::vector<int> getObjects();
-};
-
+#pragma once
+#include "Property.h"
+#include "Transform.h"
+#include <map>
+
+/*
+* Property defining an object's location in space (i.e. that an object has a particular location, size, etc.). The object's
+* location in space is represented using a Transform (a plain position and bounding box, so nothing here depends on SFML). New
+* objects can be added and their transforms retrieved.
+*
+* Each object's bounding box is also kept here, next to those of the other objects, and updated as soon as the object's transform
+* reports that it has moved, so collision checks only ever read it. Moves are also recorded per tick
+* (see beginTick), so systems can ask which objects have moved this tick and skip the ones that haven't.
+* 
+* Property Dependencies: none
+*/
+class LocationInSpace :
+    public Property
+{
+    private:
+        /* transforms pertaining to each object with this property (this and the arrays below are indexed the same as objects) */
+        std::vector<Transform*> objectTransforms;
+
+        /* bounding box of each object */
+        std::vector<Transform::Bounds> objectBounds;
+
+        /* values indicating whether each object has been moved this tick (even if it has since moved back) */
+        std::vector<char> touchedValues;
+
+        /* position of each object at the start of the tick (only valid for objects moved this tick) */
+        std::vector<float> tickStartXs;
+        std::vector<float> tickStartYs;
+
+        /* ids of objects moved this tick (so only they need resetting when the next tick begins) */
+        std::vector<int> touchedObjects;
+
+        /*
+        * Records that the given object's transform has just moved. Called by the transform itself.
+        * 
+        * id: id of object
+        * previousX: x coordinate before the move
+        * previousY: y coordinate before the move
+        */
+        void onObjectMoved(int id, float previousX, float previousY);
+
+        friend class Transform;
+
+    public:
+        /*
+        * Constructs a LocationInSpace property instance with the given values.
+        * 
+        * id: id of the property
+        * propertyRegistry: registry of all properties
+        */
+        LocationInSpace(int id, PropertyRegistry* propertyRegistry);
+
+        /*
+        * Adds an object to this property using the given transform to indicate its location in space.
+        * 
+        * id: id of object to add
+        * transform: transform used to represent object's location in space (size, position, etc.)
+        */
+        void addObject(int id, Transform* transform);
+
+        /*
+        * Removes an object from this property to undefine its location in space.
+        * 
+        * id: id of object to remove
+        */
+        void removeObject(int id);
+
+        /*
+        * Returns a pointer to the transform corresponding to the given object.
+        * 
+        * id: id of object to retrieve transform of
+        * 
+        * returns: pointer to transform representing object's location in space (or nullptr if no such object)
+        */
+        Transform* getObjectTransform(int id);
+
+        /*
+        * Returns a pointer to the transform corresponding to the object at the given index (see Property::getObjectAt).
+        * 
+        * index: index of object
+        * 
+        * returns: pointer to transform representing object's location in space
+        */
+        Transform* getObjectTransformAt(int index);
+
+        /*
+        * Returns the bounding box of the given object.
+        * 
+        * id: id of object
+        * 
+        * returns: pointer to object's bounding box (or nullptr if no such object)
+        */
+        const Transform::Bounds* getObjectBounds(int id);
+
+        /*
+        * Returns the bounding box of the object at the given index (see Property::getObjectAt).
+        * 
+        * index: index of object
+        * 
+        * returns: object's bounding box
+        */
+        const Transform::Bounds& getObjectBoundsAt(int index);
+
+        /*
+        * Starts a new tick, forgetting which objects moved during the last one. Should be called at the start of every tick.
+        */
+        void beginTick();
+
+        /*
+        * Returns whether the given object has ended up somewhere other than where it started this tick (an object that was moved
+        * and then moved back, such as when checking for collision, hasn't moved).
+        * 
+        * id: id of object
+        * 
+        * returns: true if object has moved this tick, false otherwise
+        */
+        bool hasMovedThisTick(int id);
+
+        /*
+        * Returns whether the object at the given index (see Property::getObjectAt) has ended up somewhere other than where it
+        * started this tick.
+        * 
+        * index: index of object
+        * 
+        * returns: true if object has moved this tick, false otherwise
+        */
+        bool hasMovedThisTickAt(int index);
+
+        /*
+        * Returns property's list of objects. Allows for obtaining ids/locations of individual objects.
+        *
+        * returns: list of objects
+        */
+        const std::vector<int>& getObjects();
+};
+
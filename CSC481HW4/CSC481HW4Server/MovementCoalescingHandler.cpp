@@ -0,0 +1,64 @@
+#include "MovementCoalescingHandler.h"
+
+MovementCoalescingHandler::MovementCoalescingHandler(PropertyRegistry* propertyRegistry, bool notifyWhileReplaying)
+	: EventHandler(propertyRegistry, notifyWhileReplaying)
+{
+}
+
+void MovementCoalescingHandler::onEvent(Event* e)
+{
+	switch (e->getType())
+	{
+	case ClientServerConsts::CHARACTER_MOVED_EVENT:
+	case ClientServerConsts::CHARACTER_MOVED_BY_GRAVITY_EVENT:
+	case ClientServerConsts::CHARACTER_MOVED_BY_PLATFORM_EVENT:
+	{
+		EventSchemas::Movement& movement = e->getPayload<EventSchemas::Movement>();
+
+		//start a new net movement if this is the character's first movement this pass
+		std::map<int, NetMovement>::iterator netMovementIt = netMovements.find(movement.objectId);
+		if (netMovementIt == netMovements.end())
+		{
+			NetMovement netMovement = { movement.locationInSpaceId, 0.f, 0.f, 0.f, 0.f, e->getTimestamp() };
+			netMovementIt = netMovements.insert(std::pair<int, NetMovement>(movement.objectId, netMovement)).first;
+			movedCharacters.push_back(movement.objectId);
+		}
+
+		//add movement to net movement, and keep latest absolute position
+		NetMovement& netMovement = netMovementIt->second;
+		netMovement.xMoved += movement.xMoved;
+		netMovement.yMoved += movement.yMoved;
+		netMovement.absoluteX = movement.absoluteX;
+		netMovement.absoluteY = movement.absoluteY;
+		if (e->getTimestamp() > netMovement.latestTimestamp)
+		{
+			netMovement.latestTimestamp = e->getTimestamp();
+		}
+		break;
+	}
+	}
+}
+
+void MovementCoalescingHandler::onDispatchEnd()
+{
+	int movedCharactersNum = movedCharacters.size();
+	for (int i = 0; i < movedCharactersNum; i++)
+	{
+		NetMovement& netMovement = netMovements.at(movedCharacters[i]);
+
+		//character ended up where it started, so there's nothing to report
+		if (netMovement.xMoved == 0.f && netMovement.yMoved == 0.f)
+		{
+			continue;
+		}
+
+		EventSchemas::Movement movement = { movedCharacters[i], netMovement.locationInSpaceId, netMovement.xMoved, netMovement.yMoved,
+			netMovement.absoluteX, netMovement.absoluteY };
+		Event* netMovedEvent = EventManager::getManager()->createEvent(netMovement.latestTimestamp,
+			ClientServerConsts::CHARACTER_NET_MOVED_EVENT, movement);
+		EventManager::getManager()->raise(netMovedEvent);
+	}
+
+	movedCharacters.clear();
+	netMovements.clear();
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "EventHandler.h"
+#include "EventManager.h"
+#include "ClientServerConsts.h"
+#include <vector>
+#include <map>
+
+/*
+* An EventHandler that folds all of a character's movements (player directed, gravity, and platform) within one pass of event
+* handling into a single net movement event, so that handlers that only care about where a character ended up (such as publishing
+* positional updates or checking for collisions) handle each moved character once per pass rather than once per movement.
+* 
+* Must be registered with EventManager::registerForDispatchEnd so that it raises the net movements at the end of each pass.
+*/
+class MovementCoalescingHandler :
+    public EventHandler
+{
+    private:
+        /*
+        * Net movement of a character so far in the current pass.
+        */
+        struct NetMovement
+        {
+            int locationInSpaceId;
+            float xMoved;
+            float yMoved;
+            float absoluteX;
+            float absoluteY;
+            float latestTimestamp;
+        };
+
+        /* characters moved in the current pass, in the order they first moved */
+        std::vector<int> movedCharacters;
+
+        /* net movement of each character moved in the current pass */
+        std::map<int, NetMovement> netMovements;
+
+    public:
+        /*
+        * Constructs a MovementCoalescingHandler with the given values.
+        * 
+        * propertyRegistry: registry of all properties
+        * notifyWhileReplaying: whether to notify this handler of events while a replay is being played
+        */
+        MovementCoalescingHandler(PropertyRegistry* propertyRegistry, bool notifyWhileReplaying);
+
+        /*
+        * Adds the movement in the given event to the character's net movement for the current pass.
+        * 
+        * e: event being handled
+        */
+        void onEvent(Event* e);
+
+        /*
+        * Raises a net movement event for each character that moved in the current pass (unless it ended up where it started). Each
+        * is stamped with the time of the character's latest movement so that it is handled in the same pass.
+        */
+        void onDispatchEnd();
+};
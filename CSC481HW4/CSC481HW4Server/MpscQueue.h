@@ -0,0 +1,143 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+/*
+* A bounded lock-free queue that any number of threads can push into and a single thread pops from. Each cell carries a sequence
+* number that tells producers whether it is free to fill and tells the consumer whether it has been filled, so producers only
+* contend on a single atomic counter and never block the consumer (or each other) with a lock.
+*
+* Based on Dmitry Vyukov's bounded MPMC queue, simplified for a single consumer.
+*/
+template <typename T>
+class MpscQueue
+{
+	private:
+		/*
+		* A slot in the ring along with its sequence number.
+		*/
+		struct Cell
+		{
+			std::atomic<size_t> sequence;
+			T value;
+		};
+
+		/* ring of cells (size is a power of two) */
+		Cell* cells;
+
+		/* mask used to wrap positions into the ring */
+		size_t mask;
+
+		/* padding to keep the producer counter on its own cache line */
+		char producerPadding[64];
+
+		/* position of the next cell to push into (shared by producers) */
+		std::atomic<size_t> enqueuePosition;
+
+		/* padding to keep the consumer position on its own cache line */
+		char consumerPadding[64];
+
+		/* position of the next cell to pop from (only touched by the consumer) */
+		size_t dequeuePosition;
+
+	public:
+		/*
+		* Constructs an empty queue that can hold the given number of items.
+		*
+		* capacity: maximum number of items queued at once (rounded up to a power of two)
+		*/
+		MpscQueue(size_t capacity)
+		{
+			size_t size = 1;
+			while (size < capacity)
+			{
+				size <<= 1;
+			}
+
+			cells = new Cell[size];
+			for (size_t i = 0; i < size; i++)
+			{
+				cells[i].sequence.store(i, std::memory_order_relaxed);
+			}
+			mask = size - 1;
+			enqueuePosition.store(0, std::memory_order_relaxed);
+			dequeuePosition = 0;
+		}
+
+		~MpscQueue()
+		{
+			delete[] cells;
+		}
+
+		MpscQueue(const MpscQueue&) = delete;
+		MpscQueue& operator=(const MpscQueue&) = delete;
+
+		/*
+		* Pushes a copy of the given item. Safe to call from any thread.
+		*
+		* value: item to push
+		*
+		* returns: true if the item was pushed, false if the queue is full
+		*/
+		bool push(const T& value)
+		{
+			size_t position = enqueuePosition.load(std::memory_order_relaxed);
+			Cell* cell;
+
+			while (true)
+			{
+				cell = &cells[position & mask];
+				size_t sequence = cell->sequence.load(std::memory_order_acquire);
+				ptrdiff_t difference = (ptrdiff_t)sequence - (ptrdiff_t)position;
+
+				//cell is free, so try to claim it
+				if (difference == 0)
+				{
+					if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				//cell still holds an item from the last lap, so the queue is full
+				else if (difference < 0)
+				{
+					return false;
+				}
+				//another producer claimed the cell first, so try again further along
+				else
+				{
+					position = enqueuePosition.load(std::memory_order_relaxed);
+				}
+			}
+
+			cell->value = value;
+			cell->sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*
+		* Pops the oldest item, if any. Must only be called from the consumer thread.
+		*
+		* value: set to the popped item
+		*
+		* returns: true if an item was popped, false if the queue is empty
+		*/
+		bool pop(T& value)
+		{
+			Cell* cell = &cells[dequeuePosition & mask];
+			size_t sequence = cell->sequence.load(std::memory_order_acquire);
+
+			//cell hasn't been filled yet (or its producer hasn't finished writing it)
+			if ((ptrdiff_t)sequence - (ptrdiff_t)(dequeuePosition + 1) < 0)
+			{
+				return false;
+			}
+
+			value = cell->value;
+
+			//free the cell for the producer that will reach it on the next lap
+			cell->sequence.store(dequeuePosition + mask + 1, std::memory_order_release);
+			dequeuePosition++;
+			return true;
+		}
+};
@@ -0,0 +1,187 @@
+#pragma once
+#include <vector>
+#include <new>
+#include <utility>
+#include <iostream>
+
+/*
+* A pool of objects of a single type, stored together in fixed-size chunks rather than each in its own heap allocation. Objects
+* never move once created, so pointers to them stay valid until they're released (properties such as LocationInSpace keep
+* them). Released objects' slots are reused by the next objects acquired, so once the pool has grown to the largest number of
+* objects alive at once, acquiring and releasing objects doesn't touch the heap at all. Everything in the pool can also be
+* released at once, such as when a level is torn down.
+*/
+template <typename T>
+class ObjectPool
+{
+	private:
+		/* number of objects each chunk holds */
+		int chunkSize;
+
+		/* storage chunks, each with room for chunkSize objects */
+		std::vector<T*> chunks;
+
+		/* whether each slot holds a live object, indexed by slot (chunk number * chunkSize + index in chunk) */
+		std::vector<char> liveValues;
+
+		/* slots of released objects, available for reuse */
+		std::vector<int> freeSlots;
+
+		/* number of live objects */
+		int liveNum;
+
+		/*
+		* Returns the object in the given slot.
+		*
+		* slot: slot of object
+		*
+		* returns: pointer to slot's storage
+		*/
+		T* slotAt(int slot)
+		{
+			return chunks[slot / chunkSize] + slot % chunkSize;
+		}
+
+		/*
+		* Returns the slot holding the given object.
+		*
+		* object: object in this pool
+		*
+		* returns: slot of object, or -1 if it isn't from this pool
+		*/
+		int slotOf(T* object)
+		{
+			//there are only ever a few chunks, so searching them is cheap
+			int chunksNum = chunks.size();
+			for (int i = 0; i < chunksNum; i++)
+			{
+				if (object >= chunks[i] && object < chunks[i] + chunkSize)
+				{
+					return i * chunkSize + (int)(object - chunks[i]);
+				}
+			}
+			return -1;
+		}
+
+	public:
+		/*
+		* Constructs an empty pool. No storage is allocated until the first object is acquired.
+		*
+		* chunkSize: number of objects to allocate room for at a time
+		*/
+		ObjectPool(int chunkSize)
+		{
+			this->chunkSize = chunkSize;
+			liveNum = 0;
+		}
+
+		/*
+		* Destroys every live object and frees the pool's storage.
+		*/
+		~ObjectPool()
+		{
+			releaseAll();
+			int chunksNum = chunks.size();
+			for (int i = 0; i < chunksNum; i++)
+			{
+				::operator delete(chunks[i]);
+			}
+		}
+
+		ObjectPool(const ObjectPool&) = delete;
+		ObjectPool& operator=(const ObjectPool&) = delete;
+
+		/*
+		* Creates an object in the pool from the given constructor arguments, reusing a released object's slot if there is one.
+		*
+		* args: arguments to pass to T's constructor
+		*
+		* returns: pointer to new object (valid until it's released)
+		*/
+		template <typename... Args>
+		T* acquire(Args&&... args)
+		{
+			int slot;
+			if (!freeSlots.empty())
+			{
+				slot = freeSlots.back();
+				freeSlots.pop_back();
+			}
+			else
+			{
+				//every slot so far is in use, so add a chunk
+				slot = liveValues.size();
+				if (slot % chunkSize == 0)
+				{
+					chunks.push_back((T*)::operator new(sizeof(T) * chunkSize));
+				}
+				liveValues.push_back(false);
+			}
+
+			T* object = new (slotAt(slot)) T(std::forward<Args>(args)...);
+			liveValues[slot] = true;
+			liveNum++;
+			return object;
+		}
+
+		/*
+		* Destroys the given object and makes its slot available for reuse.
+		*
+		* object: object to release (must have been acquired from this pool)
+		*/
+		void release(T* object)
+		{
+			int slot = slotOf(object);
+			if (slot < 0 || !liveValues[slot])
+			{
+				std::cerr << "Cannot release object that isn't live in this pool" << std::endl;
+				return;
+			}
+
+			object->~T();
+			liveValues[slot] = false;
+			freeSlots.push_back(slot);
+			liveNum--;
+		}
+
+		/*
+		* Destroys every live object at once, keeping the storage for objects acquired afterwards. Pointers to any of the pool's
+		* objects are no longer valid after this.
+		*/
+		void releaseAll()
+		{
+			freeSlots.clear();
+			int slotsNum = liveValues.size();
+			//fill free list backwards so slots are reused from the start of the pool
+			for (int i = slotsNum - 1; i >= 0; i--)
+			{
+				if (liveValues[i])
+				{
+					slotAt(i)->~T();
+					liveValues[i] = false;
+				}
+				freeSlots.push_back(i);
+			}
+			liveNum = 0;
+		}
+
+		/*
+		* Returns the number of live objects.
+		*
+		* returns: number of live objects
+		*/
+		int getLiveNum()
+		{
+			return liveNum;
+		}
+
+		/*
+		* Returns the number of objects the pool has room for without allocating more storage.
+		*
+		* returns: capacity of pool
+		*/
+		int getCapacity()
+		{
+			return chunks.size() * chunkSize;
+		}
+};
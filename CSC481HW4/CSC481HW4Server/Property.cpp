@@ -1,27 +1,37 @@
-#include "Property.h"
-
-Property::Property(int id, std::map<int, Property*>* propertyMap)
-{
-	this->id = id;
-	this->propertyMap = propertyMap;
-}
-
-bool Property::hasObject(int id)
-{
-	int objectsNum = objects.size();
-
-	for (int i = 0; i < objectsNum; i++)
-	{
-		if (objects[i] == id)
-		{
-			return true;
-		}
-	}
-
-	return false;
-}
-
-int Property::getId()
-{
-	return id;
-}
+#include "Property.h"
+
+Property::Property(int id, PropertyRegistry* propertyRegistry)
+{
+	this->id = id;
+	this->propertyRegistry = propertyRegistry;
+}
+
+Property::~Property()
+{
+	//nothing to free here; subclasses free their own data
+}
+
+bool Property::hasObject(int id)
+{
+	return objects.contains(id);
+}
+
+int Property::getObjectsNum()
+{
+	return objects.size();
+}
+
+int Property::getObjectAt(int index)
+{
+	return objects.idAt(index);
+}
+
+int Property::getIndexOf(int id)
+{
+	return objects.indexOf(id);
+}
+
+int Property::getId()
+{
+	return id;
+}
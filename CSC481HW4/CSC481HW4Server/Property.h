@@ -1,50 +1,92 @@
-#include <stdlib.h>
-#include <vector>
-#include <string>
-#include <map>
-
-/*
-* An abstract class representing a property used to define game objects. A property contains a list of game objects with the instance of the
-* property (as ids), a unique id, and a pointer to the map for all property instances.
-*/
-#pragma once
-class Property
-{
-	private:
-		/* id of this property */
-		int id;
-
-	protected:
-
-		/* ids of game objects exhibiting this property */
-		std::vector<int> objects;
-
-		/* map of all properties (used in coordinating property operations) */
-		std::map<int, Property*>* propertyMap;
-
-		/*
-		* Constructs a Property with the given id and map of all properties.
-		* 
-		* id: id for this property
-		* propertyMap: map of all properties (used in coordinating operations between properties)
-		*/
-		Property(int id, std::map<int, Property*>* propertyMap);
-
-	public:
-		/*
-		* Returns indicating whether the given object has this property.
-		* 
-		* id: id of object to check for
-		* 
-		* returns: true if object has this property, false otherwise
-		*/
-		bool hasObject(int id);
-
-		/*
-		* Returns this property's id.
-		* 
-		* returns: this property's id
-		*/
-		int getId();
-};
-
+#include <stdlib.h>
+#include <vector>
+#include <string>
+#include <map>
+#include "SparseSet.h"
+#include "PropertyRegistry.h"
+
+/*
+* An abstract class representing a property used to define game objects. A property contains a list of game objects with the instance of the
+* property (as ids), a unique id, and a pointer to the registry of all property instances.
+*/
+#pragma once
+class Property
+{
+	private:
+		/* id of this property */
+		int id;
+
+	protected:
+
+		/* ids of game objects exhibiting this property, each mapped to its index in the property's per-object data (removing an
+		object moves the last object into its index) */
+		SparseSet objects;
+
+		/* registry of all properties (used in coordinating property operations) */
+		PropertyRegistry* propertyRegistry;
+
+		/*
+		* Constructs a Property with the given id and registry of all properties.
+		* 
+		* id: id for this property
+		* propertyRegistry: registry of all properties (used in coordinating operations between properties)
+		*/
+		Property(int id, PropertyRegistry* propertyRegistry);
+
+	public:
+		/*
+		* Destroys the property. Virtual so that properties can be deleted through the registry.
+		*/
+		virtual ~Property();
+
+		/*
+		* Removes an object from this property. Properties each add objects with their own per-object data, but all remove them
+		* the same way, so objects can be removed without knowing the property's type (see StructuralChangeBuffer).
+		* 
+		* objectId: id of object to remove
+		*/
+		virtual void removeObject(int objectId) = 0;
+
+		/*
+		* Returns indicating whether the given object has this property.
+		* 
+		* id: id of object to check for
+		* 
+		* returns: true if object has this property, false otherwise
+		*/
+		bool hasObject(int id);
+
+		/*
+		* Returns the number of objects with this property.
+		* 
+		* returns: number of objects
+		*/
+		int getObjectsNum();
+
+		/*
+		* Returns the id of the object at the given index. Objects are stored densely at indices 0 to getObjectsNum() - 1 (which
+		* change when objects are removed), and properties that store per-object data in arrays index it the same way.
+		* 
+		* index: index of object
+		* 
+		* returns: id of object
+		*/
+		int getObjectAt(int index);
+
+		/*
+		* Returns the index of the given object (see getObjectAt).
+		* 
+		* id: id of object
+		* 
+		* returns: index of object, or -1 if the object doesn't have this property
+		*/
+		int getIndexOf(int id);
+
+		/*
+		* Returns this property's id.
+		* 
+		* returns: this property's id
+		*/
+		int getId();
+};
+
@@ -0,0 +1,189 @@
+#pragma once
+#include <array>
+#include <tuple>
+#include "Property.h"
+
+/*
+* Iterates over the objects that have every one of a set of properties (such as every character with a LocationInSpace, Collision
+* and Gravity). Iteration is driven by whichever property has the fewest objects, and each other property is only probed for the
+* objects that one has, so no list of objects is copied or built up along the way. Each row gives the object's id along with its
+* index in each of the properties, which the properties' index-based accessors (such as LocationInSpace::getObjectTransformAt) take
+* to reach the object's data in place.
+*
+* Objects must not be added to or removed from any of the properties while iterating, since that changes their indices.
+*
+* Example:
+*     PropertyJoin<LocationInSpace, Gravity> characters(characterLocationInSpace, characterGravity);
+*     for (PropertyJoin<LocationInSpace, Gravity>::Row& character : characters)
+*     {
+*         Transform* transform = characterLocationInSpace->getObjectTransformAt(character.getIndex<0>());
+*         ...
+*     }
+*/
+template <typename... Properties>
+class PropertyJoin
+{
+	static_assert(sizeof...(Properties) > 0, "PropertyJoin needs at least one property");
+
+	public:
+		/* number of properties joined */
+		static constexpr size_t PROPERTIES_NUM = sizeof...(Properties);
+
+		/*
+		* An object that has every joined property, along with its index in each of them.
+		*/
+		class Row
+		{
+			friend class PropertyJoin;
+
+			private:
+				/* id of object */
+				int id;
+
+				/* index of object in each property, in the order the properties were given */
+				std::array<int, PROPERTIES_NUM> indices;
+
+			public:
+				/*
+				* Returns the id of the object.
+				*
+				* returns: id of object
+				*/
+				int getId()
+				{
+					return id;
+				}
+
+				/*
+				* Returns the index of the object in the property at the given position in the join.
+				*
+				* returns: index of object in property I
+				*/
+				template <size_t I>
+				int getIndex()
+				{
+					return indices[I];
+				}
+		};
+
+		/*
+		* Iterator over the rows of the join.
+		*/
+		class Iterator
+		{
+			private:
+				/* join being iterated over */
+				PropertyJoin* join;
+
+				/* index of the current object in the driving property */
+				int driverIndex;
+
+				/* current row */
+				Row row;
+
+				/*
+				* Moves forward to the first object from the current one that has every property, filling in the row for it.
+				*/
+				void seek()
+				{
+					int driverObjectsNum = join->properties[join->driverPosition]->getObjectsNum();
+					while (driverIndex < driverObjectsNum && !join->fillRow(driverIndex, row))
+					{
+						driverIndex++;
+					}
+				}
+
+			public:
+				Iterator(PropertyJoin* join, int driverIndex)
+				{
+					this->join = join;
+					this->driverIndex = driverIndex;
+					seek();
+				}
+
+				Row& operator*()
+				{
+					return row;
+				}
+
+				Iterator& operator++()
+				{
+					driverIndex++;
+					seek();
+					return *this;
+				}
+
+				bool operator!=(const Iterator& other)
+				{
+					return driverIndex != other.driverIndex;
+				}
+		};
+
+	private:
+		/* properties joined, in the order they were given */
+		std::array<Property*, PROPERTIES_NUM> properties;
+
+		/* position of the property with the fewest objects, which drives iteration */
+		size_t driverPosition;
+
+		/*
+		* Fills in the row for the object at the given index in the driving property.
+		*
+		* driverIndex: index of object in the driving property
+		* row: row to fill in
+		*
+		* returns: true if the object has every property, false otherwise
+		*/
+		bool fillRow(int driverIndex, Row& row)
+		{
+			row.id = properties[driverPosition]->getObjectAt(driverIndex);
+			for (size_t i = 0; i < PROPERTIES_NUM; i++)
+			{
+				row.indices[i] = i == driverPosition ? driverIndex : properties[i]->getIndexOf(row.id);
+				if (row.indices[i] < 0)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+	public:
+		/*
+		* Constructs a join over the given properties.
+		*
+		* properties: properties to join (rows give indices in this order)
+		*/
+		PropertyJoin(Properties*... properties) : properties{ { properties... } }
+		{
+			driverPosition = 0;
+			for (size_t i = 1; i < PROPERTIES_NUM; i++)
+			{
+				if (this->properties[i]->getObjectsNum() < this->properties[driverPosition]->getObjectsNum())
+				{
+					driverPosition = i;
+				}
+			}
+		}
+
+		/*
+		* Returns the property at the given position in the join.
+		*
+		* returns: property I
+		*/
+		template <size_t I>
+		typename std::tuple_element<I, std::tuple<Properties...>>::type* getProperty()
+		{
+			return (typename std::tuple_element<I, std::tuple<Properties...>>::type*)properties[I];
+		}
+
+		Iterator begin()
+		{
+			return Iterator(this, 0);
+		}
+
+		Iterator end()
+		{
+			return Iterator(this, properties[driverPosition]->getObjectsNum());
+		}
+};
@@ -0,0 +1,73 @@
+#include "PropertyRegistry.h"
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include "Property.h"
+
+PropertyRegistry::PropertyRegistry()
+{
+	propertiesNum = 0;
+}
+
+void PropertyRegistry::add(Property* property)
+{
+	int id = property->getId();
+	if (id < 0)
+	{
+		std::cerr << "Cannot register property with negative id" << std::endl;
+		return;
+	}
+
+	if (has(id))
+	{
+		std::cerr << "Cannot register duplicate property id" << std::endl;
+		return;
+	}
+
+	if (id >= (int)properties.size())
+	{
+		properties.resize(id + 1, nullptr);
+	}
+
+	properties[id] = property;
+	propertiesNum++;
+}
+
+Property* PropertyRegistry::remove(int id)
+{
+	if (!has(id))
+	{
+		return nullptr;
+	}
+
+	Property* property = properties[id];
+	properties[id] = nullptr;
+	propertiesNum--;
+	return property;
+}
+
+Property* PropertyRegistry::at(int id)
+{
+	if (!has(id))
+	{
+		throw std::out_of_range("No property with id " + std::to_string(id));
+	}
+
+	return properties[id];
+}
+
+int PropertyRegistry::size()
+{
+	return propertiesNum;
+}
+
+void PropertyRegistry::deleteAll()
+{
+	int propertiesSize = properties.size();
+	for (int i = 0; i < propertiesSize; i++)
+	{
+		delete(properties[i]);
+		properties[i] = nullptr;
+	}
+	propertiesNum = 0;
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <vector>
+
+class Property;
+
+/*
+* Holds every property instance, stored in an array indexed by property id (property ids are handed out in order, so the array
+* stays small and mostly full). Looking up a property is a single indexed load, and get returns it already cast to the type the
+* caller expects, so handlers can resolve the properties they use once when they're constructed rather than on every event.
+*/
+class PropertyRegistry
+{
+	private:
+		/* property with each id (or nullptr if none), indexed by property id */
+		std::vector<Property*> properties;
+
+		/* number of properties registered */
+		int propertiesNum;
+
+	public:
+		/*
+		* Constructs an empty registry.
+		*/
+		PropertyRegistry();
+
+		/*
+		* Registers the given property under its id.
+		*
+		* property: property to register
+		*/
+		void add(Property* property);
+
+		/*
+		* Unregisters the property with the given id (without deleting it).
+		*
+		* id: id of property
+		*
+		* returns: property that was registered under the id, or nullptr if there was none
+		*/
+		Property* remove(int id);
+
+		/*
+		* Returns whether a property is registered under the given id.
+		*
+		* id: id of property
+		*
+		* returns: true if a property has the id, false otherwise
+		*/
+		bool has(int id)
+		{
+			return id >= 0 && id < (int)properties.size() && properties[id] != nullptr;
+		}
+
+		/*
+		* Returns the property with the given id. Unlike get, the id is checked first.
+		*
+		* id: id of property
+		*
+		* returns: property with the id
+		*
+		* throws: std::out_of_range if no property has the id
+		*/
+		Property* at(int id);
+
+		/*
+		* Returns the property with the given id as the given type. The id isn't checked, so it must belong to a registered property
+		* of that type.
+		*
+		* id: id of property
+		*
+		* returns: property with the id
+		*/
+		template <typename T>
+		T* get(int id)
+		{
+			return static_cast<T*>(properties[id]);
+		}
+
+		/*
+		* Returns the number of properties registered.
+		*
+		* returns: number of properties
+		*/
+		int size();
+
+		/*
+		* Unregisters and deletes every property.
+		*/
+		void deleteAll();
+};
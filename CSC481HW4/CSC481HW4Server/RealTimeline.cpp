@@ -1,26 +1,20 @@
-#include "RealTimeline.h"
-#include <chrono>
-
-RealTimeline::RealTimeline(float tic) : Timeline(tic)
-{
-    startTime = std::chrono::steady_clock::now();
-}
-
-float RealTimeline::getTime()
-{
-    //if timeline is paused, return negative value
-    if (isPaused())
-    {
-        return -1.f;
-    }
-
-    //get current time
-    std::chrono::steady_clock::time_point currentTime = std::chrono::steady_clock::now();
-
-    //calculate total elapsed time (subtracting out paused time)
-    float elapsedTime = std::chrono::duration<float>(currentTime - startTime).count();
-    elapsedTime -= getElapsedPauseTime();
-
-    //return total elapsed time divided by current tic size
-    return elapsedTime / getTic();
-}
+#include "RealTimeline.h"
+
+RealTimeline::RealTimeline(float tic) : Timeline(tic, nullptr)
+{
+    startTicks = getClockSource()->readTicks();
+}
+
+float RealTimeline::computeTime()
+{
+    //get current time (as of the start of the tick if time is frozen)
+    long long currentTicks = now();
+
+    //calculate total elapsed time (subtracting out paused time), taking the difference in whole ticks and staying in double
+    //precision until the end so that precision is only lost once
+    double elapsedTime = (double)(currentTicks - startTicks) / getClockSource()->getTicksPerSecond();
+    elapsedTime -= getElapsedPauseTime();
+
+    //return total elapsed time divided by current tic size
+    return (float)(elapsedTime / getTic());
+}
@@ -1,83 +1,118 @@
-#include "Rendering.h"
-#include <iostream>
-#include "LocationInSpace.h"
-
-Rendering::Rendering(int id, std::map<int, Property*>* propertyMap, sf::RenderWindow* window) : Property(id, propertyMap)
-{
-	this->window = window;
-}
-
-void Rendering::addObject(int objectId, int locationInSpaceId)
-{
-	if (hasObject(objectId))
-	{
-		std::cerr << "Cannot add duplicate object to Rendering" << std::endl;
-		return;
-	}
-
-	objects.push_back(objectId);
-	locationsInSpace.insert(std::pair<int, int>(objectId, locationInSpaceId));
-}
-
-void Rendering::removeObject(int id)
-{
-	if (!hasObject(id))
-	{
-		std::cerr << "No such object defined in Rendering" << std::endl;
-		return;
-	}
-
-	//remove from objects list
-	int objectsNum = objects.size();
-	for (int i = 0; i < objectsNum; i++)
-	{
-		if (objects[i] == id)
-		{
-			objects.erase(objects.begin() + i);
-		}
-	}
-
-	//remove from map of locations in space
-	locationsInSpace.erase(id);
-}
-
-void Rendering::drawObject(int objectId)
-{
-	//make sure object is defined in this property
-	if (!hasObject(objectId))
-	{
-		std::cerr << "Unable to draw object: No object with this id defined in Rendering" << std::endl;
-		return;
-	}
-
-	LocationInSpace* locationInSpace;
-
-	//get location in space for object
-	try
-	{
-		locationInSpace = (LocationInSpace*) propertyMap->at(locationsInSpace.at(objectId));
-	}
-	catch (std::out_of_range)
-	{
-		std::cerr << "Unable to draw object: invalid LocationInSpace" << std::endl;
-		return;
-	}
-
-	//retrieve object's shape
-	sf::Shape* objectShape = (sf::Shape*) locationInSpace->getObjectShape(objectId);
-
-	//draw object to window
-	window->draw(*objectShape);
-}
-
-void Rendering::drawAllObjects()
-{
-	//draw all objects
-	int objectsNum = objects.size();
-	for (int i = 0; i < objectsNum; i++)
-	{
-		drawObject(objects[i]);
-	}
-}
-
-
+#include "Rendering.h"
+#include <iostream>
+#include "LocationInSpace.h"
+
+Rendering::Rendering(int id, PropertyRegistry* propertyRegistry, sf::RenderWindow* window) : Property(id, propertyRegistry)
+{
+	this->window = window;
+}
+
+void Rendering::addObject(int objectId, int locationInSpaceId, sf::Shape* view)
+{
+	if (hasObject(objectId))
+	{
+		std::cerr << "Cannot add duplicate object to Rendering" << std::endl;
+		return;
+	}
+
+	objects.insert(objectId);
+	locationsInSpace.push_back(locationInSpaceId);
+	views.push_back(view);
+}
+
+void Rendering::removeObject(int id)
+{
+	//remove from objects list
+	int index = objects.remove(id);
+	if (index < 0)
+	{
+		std::cerr << "No such object defined in Rendering" << std::endl;
+		return;
+	}
+
+	//remove from arrays (the last object takes the removed object's index, as in objects)
+	swapRemove(locationsInSpace, index);
+	swapRemove(views, index);
+}
+
+sf::Shape* Rendering::getObjectView(int objectId)
+{
+	int index = objects.indexOf(objectId);
+	if (index < 0)
+	{
+		return nullptr;
+	}
+
+	return views[index];
+}
+
+LocationInSpace* Rendering::getLocationInSpace(int locationInSpaceId)
+{
+	if (!propertyRegistry->has(locationInSpaceId))
+	{
+		std::cerr << "Unable to draw object: invalid LocationInSpace" << std::endl;
+		return nullptr;
+	}
+
+	return propertyRegistry->get<LocationInSpace>(locationInSpaceId);
+}
+
+void Rendering::drawObject(int objectId)
+{
+	//make sure object is defined in this property
+	int index = objects.indexOf(objectId);
+	if (index < 0)
+	{
+		std::cerr << "Unable to draw object: No object with this id defined in Rendering" << std::endl;
+		return;
+	}
+
+	LocationInSpace* locationInSpace = getLocationInSpace(locationsInSpace[index]);
+	if (locationInSpace == nullptr)
+	{
+		return;
+	}
+
+	drawObjectAt(index, locationInSpace);
+}
+
+void Rendering::drawObjectAt(int index, LocationInSpace* locationInSpace)
+{
+	//retrieve object's transform
+	Transform* objectTransform = locationInSpace->getObjectTransform(objects.idAt(index));
+	if (objectTransform == nullptr)
+	{
+		std::cerr << "Unable to draw object: No object with this id defined in LocationInSpace" << std::endl;
+		return;
+	}
+
+	//move view to object's position and draw it to window
+	sf::Shape* view = views[index];
+	view->setPosition(objectTransform->getX(), objectTransform->getY());
+	window->draw(*view);
+}
+
+void Rendering::drawAllObjects()
+{
+	//objects almost always share a LocationInSpace, so only look one up when it differs from the last object's
+	int locationInSpaceId = -1;
+	LocationInSpace* locationInSpace = nullptr;
+
+	//draw all objects
+	int objectsNum = objects.size();
+	for (int i = 0; i < objectsNum; i++)
+	{
+		if (locationsInSpace[i] != locationInSpaceId)
+		{
+			locationInSpaceId = locationsInSpace[i];
+			locationInSpace = getLocationInSpace(locationInSpaceId);
+		}
+
+		if (locationInSpace != nullptr)
+		{
+			drawObjectAt(i, locationInSpace);
+		}
+	}
+}
+
+
@@ -1,59 +1,96 @@
-#pragma once
-#include "Property.h"
-#include <SFML/Graphics.hpp>
-
-/*
-* Property defining an object's ability to be rendered to the window.
-* 
-* Property Dependencies: LocationInSpace
-*/
-class Rendering :
-    public Property
-{
-    private:
-        /* window to draw objects to */
-        sf::RenderWindow* window;
-
-        /* location in space corresponding to each object (used to retrieve object's shape) */
-        std::map<int, int> locationsInSpace;
-
-    public:
-        /*
-        * Constructs a Rendering property instance with the given values.
-        * 
-        * id: id of the property
-        * propertyMap: map of all properties
-        * window: window to draw to
-        */
-        Rendering(int id, std::map<int, Property*>* propertyMap, sf::RenderWindow* window);
-
-        /*
-        * Adds an object to this property to indicate it can be rendered. Object must have corresponding LocationInSpace to
-        * retrieve its shape from.
-        * 
-        * objectId: id of object to add
-        * locationInSpaceId: id of LocationInSpace corresponding to object
-        */
-        void addObject(int objectId, int locationInSpaceId);
-
-        /*
-        * Removes an object from this property.
-        * 
-        * id: id of object to remove
-        */
-        void removeObject(int id);
-
-        /*
-        * Draws the object with the given id to the window. Object must have a defined LocationInSpace used to retrieve object's
-        * shape.
-        * 
-        * objectId: id of object to draw
-        */
-        void drawObject(int objectId);
-
-        /*
-        * Draws all objects to the window. Objects must have defined LocationInSpace instances used to retrieve their shapes.
-        */
-        void drawAllObjects();
-};
-
+#pragma once
+#include "Property.h"
+#include <SFML/Graphics.hpp>
+
+class LocationInSpace;
+
+/*
+* Property defining an object's ability to be rendered to the window. Each object is drawn using an sf::Shape kept here as a
+* render view of the object; the object's actual position lives in its LocationInSpace, and is copied into the view each time
+* it's drawn. This is only used by clients, so the server never needs SFML shapes.
+* 
+* Property Dependencies: LocationInSpace
+*/
+class Rendering :
+    public Property
+{
+    private:
+        /* window to draw objects to */
+        sf::RenderWindow* window;
+
+        /* location in space corresponding to each object (used to retrieve object's transform; this and the array below are
+        indexed the same as objects) */
+        std::vector<int> locationsInSpace;
+
+        /* shape used to draw each object */
+        std::vector<sf::Shape*> views;
+
+        /*
+        * Returns the LocationInSpace with the given id, reporting it if there is none.
+        * 
+        * locationInSpaceId: id of LocationInSpace
+        * 
+        * returns: LocationInSpace with the id, or nullptr if no such property is registered
+        */
+        LocationInSpace* getLocationInSpace(int locationInSpaceId);
+
+        /*
+        * Draws the object at the given index (see Property::getObjectAt) to the window at its position in the given
+        * LocationInSpace.
+        * 
+        * index: index of object
+        * locationInSpace: LocationInSpace corresponding to object
+        */
+        void drawObjectAt(int index, LocationInSpace* locationInSpace);
+
+    public:
+        /*
+        * Constructs a Rendering property instance with the given values.
+        * 
+        * id: id of the property
+        * propertyRegistry: registry of all properties
+        * window: window to draw to
+        */
+        Rendering(int id, PropertyRegistry* propertyRegistry, sf::RenderWindow* window);
+
+        /*
+        * Adds an object to this property to indicate it can be rendered. Object must have corresponding LocationInSpace to
+        * retrieve its position from.
+        * 
+        * objectId: id of object to add
+        * locationInSpaceId: id of LocationInSpace corresponding to object
+        * view: shape to draw object with (its size and color are used as is, while its position is taken from the object's
+        * transform when drawing)
+        */
+        void addObject(int objectId, int locationInSpaceId, sf::Shape* view);
+
+        /*
+        * Removes an object from this property.
+        * 
+        * id: id of object to remove
+        */
+        void removeObject(int id);
+
+        /*
+        * Returns the shape the given object is drawn with.
+        * 
+        * objectId: id of object
+        * 
+        * returns: shape used to draw object, or nullptr if object isn't defined in this property
+        */
+        sf::Shape* getObjectView(int objectId);
+
+        /*
+        * Draws the object with the given id to the window. Object must have a defined LocationInSpace used to retrieve object's
+        * position.
+        * 
+        * objectId: id of object to draw
+        */
+        void drawObject(int objectId);
+
+        /*
+        * Draws all objects to the window. Objects must have defined LocationInSpace instances used to retrieve their positions.
+        */
+        void drawAllObjects();
+};
+
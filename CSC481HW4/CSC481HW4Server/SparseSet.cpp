@@ -0,0 +1,42 @@
+#include "SparseSet.h"
+
+int SparseSet::insert(int id)
+{
+	if (id < 0)
+	{
+		return -1;
+	}
+
+	int slot = EntityRegistry::getIndex(id);
+	if (slot >= (int)sparse.size())
+	{
+		sparse.resize(slot + 1, -1);
+	}
+
+	//slot already taken, either by this id or by another generation of it
+	if (sparse[slot] >= 0)
+	{
+		return -1;
+	}
+
+	sparse[slot] = dense.size();
+	dense.push_back(id);
+	return sparse[slot];
+}
+
+int SparseSet::remove(int id)
+{
+	int index = indexOf(id);
+	if (index < 0)
+	{
+		return -1;
+	}
+
+	//move last id into the removed id's place
+	int lastId = dense.back();
+	dense[index] = lastId;
+	sparse[EntityRegistry::getIndex(lastId)] = index;
+	dense.pop_back();
+	sparse[EntityRegistry::getIndex(id)] = -1;
+	return index;
+}
@@ -0,0 +1,127 @@
+#pragma once
+#include <vector>
+#include <utility>
+#include "EntityRegistry.h"
+
+/*
+* A sparse set mapping object ids to indices in a dense range. Properties use it to track which objects they have (so checking
+* membership is a single array access rather than a scan), and some keep each of their per-object fields in a contiguous array
+* indexed the same way rather than in a map keyed by id, so that looking up an object's fields is also a single array access and
+* iterating over every object walks the arrays in order.
+*
+* Removing an object moves the last object into its place to keep the range dense, so indices (and iteration order) change on
+* removal; every field array should be updated the same way with swapRemove. Flag fields are kept as std::vector<char> rather
+* than std::vector<bool>, so each flag is a plain byte like any other field.
+*
+* Ids are generational handles (see EntityRegistry): the sparse array is indexed by a handle's slot index, and a lookup only
+* succeeds if the id stored in the dense range matches the whole handle, so a stale handle whose slot has been reused isn't
+* mistaken for the object now in it.
+*/
+class SparseSet
+{
+	private:
+		/* index of each id in the dense range (or -1 if the id isn't in the set), indexed by the id's slot index */
+		std::vector<int> sparse;
+
+		/* ids in the set, in dense order */
+		std::vector<int> dense;
+
+	public:
+		/*
+		* Adds the given id to the end of the dense range.
+		* 
+		* id: id to add (must not be negative)
+		* 
+		* returns: index of the id, or -1 if it (or another generation of it) was already in the set
+		*/
+		int insert(int id);
+
+		/*
+		* Removes the given id, moving the last id in the dense range into its place.
+		* 
+		* id: id to remove
+		* 
+		* returns: index the id was at (which now holds what was the last id), or -1 if it wasn't in the set
+		*/
+		int remove(int id);
+
+		/*
+		* Returns the index of the given id in the dense range.
+		* 
+		* id: id to look up
+		* 
+		* returns: index of the id, or -1 if it isn't in the set
+		*/
+		int indexOf(int id)
+		{
+			int slot = EntityRegistry::getIndex(id);
+			if (id < 0 || slot >= (int)sparse.size())
+			{
+				return -1;
+			}
+
+			int index = sparse[slot];
+			return index >= 0 && dense[index] == id ? index : -1;
+		}
+
+		/*
+		* Returns whether the given id is in the set.
+		* 
+		* id: id to check for
+		* 
+		* returns: true if id is in the set, false otherwise
+		*/
+		bool contains(int id)
+		{
+			return indexOf(id) >= 0;
+		}
+
+		/*
+		* Returns the id at the given index in the dense range.
+		* 
+		* index: index in the dense range
+		* 
+		* returns: id at index
+		*/
+		int idAt(int index)
+		{
+			return dense[index];
+		}
+
+		/*
+		* Returns the number of ids in the set.
+		* 
+		* returns: number of ids
+		*/
+		int size()
+		{
+			return dense.size();
+		}
+
+		/*
+		* Returns the ids in the set, in dense order.
+		* 
+		* returns: ids in the set
+		*/
+		const std::vector<int>& getIds()
+		{
+			return dense;
+		}
+};
+
+/*
+* Removes the value at the given index from a field array the same way SparseSet::remove does, by moving the last value into
+* its place.
+* 
+* values: field array
+* index: index to remove (as returned by SparseSet::remove)
+*/
+template <typename T>
+void swapRemove(std::vector<T>& values, int index)
+{
+	if (index != (int)values.size() - 1)
+	{
+		values[index] = std::move(values.back());
+	}
+	values.pop_back();
+}
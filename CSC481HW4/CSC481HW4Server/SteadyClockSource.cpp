@@ -0,0 +1,17 @@
+#include "SteadyClockSource.h"
+#include <chrono>
+
+long long SteadyClockSource::readTicks()
+{
+    return (long long)std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+long long SteadyClockSource::getTicksPerSecond()
+{
+    return (long long)(std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num);
+}
+
+const char* SteadyClockSource::getName()
+{
+    return "steady";
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "ClockSource.h"
+
+/*
+* A clock source reading std::chrono::steady_clock. Precise (typically to the nanosecond), but each read is a call into the
+* system's high-resolution counter (QueryPerformanceCounter on Windows). This is the default clock source for timelines.
+*/
+class SteadyClockSource :
+	public ClockSource
+{
+public:
+	/*
+	* Returns the current reading of steady_clock.
+	*
+	* returns: number of steady_clock ticks since its epoch
+	*/
+	long long readTicks();
+
+	/*
+	* Returns how many steady_clock ticks make up a second.
+	*
+	* returns: ticks per second
+	*/
+	long long getTicksPerSecond();
+
+	/*
+	* Returns the name of the clock source.
+	*
+	* returns: name of clock source
+	*/
+	const char* getName();
+};
@@ -0,0 +1,82 @@
+#include "StructuralChangeBuffer.h"
+#include <algorithm>
+#include "Property.h"
+#include "EntityRegistry.h"
+
+StructuralChangeBuffer::StructuralChangeBuffer(EntityRegistry* entities)
+{
+	this->entities = entities;
+}
+
+void StructuralChangeBuffer::queueAddition(int objectId, std::function<void()> addition)
+{
+	pendingAdditions.push_back(std::pair<int, std::function<void()>>(objectId, std::move(addition)));
+}
+
+bool StructuralChangeBuffer::hasPendingAddition(int objectId)
+{
+	int additionsNum = pendingAdditions.size();
+	for (int i = 0; i < additionsNum; i++)
+	{
+		if (pendingAdditions[i].first == objectId)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void StructuralChangeBuffer::queueRemoval(Property* property, int objectId)
+{
+	pendingRemovals.push_back(std::pair<Property*, int>(property, objectId));
+}
+
+void StructuralChangeBuffer::queueRelease(std::function<void()> release)
+{
+	pendingReleases.push_back(std::move(release));
+}
+
+void StructuralChangeBuffer::queueDestruction(int objectId)
+{
+	pendingDestructions.push_back(objectId);
+}
+
+void StructuralChangeBuffer::apply()
+{
+	//group removals by property (keeping the queued order within each property, so indices end up the same every run)
+	std::stable_sort(pendingRemovals.begin(), pendingRemovals.end(),
+		[](const std::pair<Property*, int>& a, const std::pair<Property*, int>& b) { return a.first->getId() < b.first->getId(); });
+	int removalsNum = pendingRemovals.size();
+	for (int i = 0; i < removalsNum; i++)
+	{
+		pendingRemovals[i].first->removeObject(pendingRemovals[i].second);
+	}
+	pendingRemovals.clear();
+
+	//free what removed objects were using
+	int releasesNum = pendingReleases.size();
+	for (int i = 0; i < releasesNum; i++)
+	{
+		pendingReleases[i]();
+	}
+	pendingReleases.clear();
+
+	//free handles now that nothing holds their objects
+	int destructionsNum = pendingDestructions.size();
+	for (int i = 0; i < destructionsNum; i++)
+	{
+		entities->destroy(pendingDestructions[i]);
+	}
+	pendingDestructions.clear();
+
+	//add new objects in the order they were queued (skipping any destroyed before they were ever added)
+	int additionsNum = pendingAdditions.size();
+	for (int i = 0; i < additionsNum; i++)
+	{
+		if (entities->isAlive(pendingAdditions[i].first))
+		{
+			pendingAdditions[i].second();
+		}
+	}
+	pendingAdditions.clear();
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include <vector>
+#include <utility>
+#include <functional>
+
+class Property;
+class EntityRegistry;
+
+/*
+* Queues structural changes to game objects (adding objects to properties, removing them, freeing what they used, and destroying
+* their handles) so they can be applied together between ticks rather than one at a time. While a tick runs, the set of objects
+* in each property therefore stays fixed, so handlers and the tick itself can walk a property's objects by index without first
+* copying them.
+*
+* Changes are applied in a fixed order: removals first (grouped by property, so a burst of disconnects touches each property's
+* arrays in one go, each removal swapping the property's last object into the freed index), then releases of anything the
+* removed objects were using (such as their transforms), then handle destruction, then additions in the order they were queued.
+* Since a handle is only freed once its object has been removed everywhere, an object created while the removal is pending never
+* reuses its slot, and an addition whose handle has been destroyed by then is dropped.
+*/
+class StructuralChangeBuffer
+{
+	private:
+		/* registry the handles of removed objects are destroyed in */
+		EntityRegistry* entities;
+
+		/* pending removals, as the property and the id of the object to remove from it */
+		std::vector<std::pair<Property*, int>> pendingRemovals;
+
+		/* pending releases, each freeing something a removed object was using */
+		std::vector<std::function<void()>> pendingReleases;
+
+		/* handles to destroy once pending removals are done */
+		std::vector<int> pendingDestructions;
+
+		/* pending additions, as the handle of the object and the function adding it to one or more properties */
+		std::vector<std::pair<int, std::function<void()>>> pendingAdditions;
+
+	public:
+		/*
+		* Constructs an empty buffer.
+		*
+		* entities: registry the handles of removed objects are destroyed in
+		*/
+		StructuralChangeBuffer(EntityRegistry* entities);
+
+		/*
+		* Queues adding an object to properties. The given function should make the addObject calls; the object's handle should
+		* already have been created.
+		*
+		* objectId: handle of object being added
+		* addition: function adding the object to its properties
+		*/
+		void queueAddition(int objectId, std::function<void()> addition);
+
+		/*
+		* Returns whether adding the given object is still waiting to be applied.
+		*
+		* objectId: handle of object
+		*
+		* returns: true if an addition is pending for the object, false otherwise
+		*/
+		bool hasPendingAddition(int objectId);
+
+		/*
+		* Queues removing an object from a property.
+		*
+		* property: property to remove object from
+		* objectId: id of object to remove
+		*/
+		void queueRemoval(Property* property, int objectId);
+
+		/*
+		* Queues freeing something an object was using (such as returning its transform to its pool), once pending removals have
+		* been applied so that no property still holds it.
+		*
+		* release: function freeing what the object was using
+		*/
+		void queueRelease(std::function<void()> release);
+
+		/*
+		* Queues destroying an object's handle, once all pending removals have been applied. Removals from every property the
+		* object is in should also be queued.
+		*
+		* objectId: handle of object to destroy
+		*/
+		void queueDestruction(int objectId);
+
+		/*
+		* Returns whether any changes are waiting to be applied.
+		*
+		* returns: true if changes are pending, false otherwise
+		*/
+		bool hasPending()
+		{
+			return !pendingRemovals.empty() || !pendingReleases.empty() || !pendingDestructions.empty() || !pendingAdditions.empty();
+		}
+
+		/*
+		* Applies every pending change (see class description for the order) and clears the buffer. Should only be called between
+		* ticks, when nothing is iterating over properties.
+		*/
+		void apply();
+};
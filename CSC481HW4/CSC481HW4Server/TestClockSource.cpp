@@ -0,0 +1,32 @@
+#include "TestClockSource.h"
+
+TestClockSource::TestClockSource(long long ticksPerSecond)
+{
+    ticks = 0;
+    this->ticksPerSecond = ticksPerSecond;
+}
+
+long long TestClockSource::readTicks()
+{
+    return ticks;
+}
+
+long long TestClockSource::getTicksPerSecond()
+{
+    return ticksPerSecond;
+}
+
+const char* TestClockSource::getName()
+{
+    return "test";
+}
+
+void TestClockSource::setTicks(long long ticks)
+{
+    this->ticks = ticks;
+}
+
+void TestClockSource::advance(long long ticks)
+{
+    this->ticks += ticks;
+}
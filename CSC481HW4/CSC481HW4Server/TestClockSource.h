@@ -0,0 +1,60 @@
+#pragma once
+#include "ClockSource.h"
+
+/*
+* A clock source that only moves when told to, used to drive real-time timelines deterministically (such as to check how they
+* behave after a long uptime without waiting for it).
+*/
+class TestClockSource :
+	public ClockSource
+{
+private:
+	/* current reading of the clock */
+	long long ticks;
+
+	/* number of ticks that make up a second */
+	long long ticksPerSecond;
+
+public:
+	/*
+	* Constructs the clock source starting at 0 with the given resolution.
+	*
+	* ticksPerSecond: number of ticks that make up a second
+	*/
+	TestClockSource(long long ticksPerSecond);
+
+	/*
+	* Returns the current reading of the clock.
+	*
+	* returns: number of ticks set or advanced so far
+	*/
+	long long readTicks();
+
+	/*
+	* Returns how many ticks make up a second.
+	*
+	* returns: ticks per second
+	*/
+	long long getTicksPerSecond();
+
+	/*
+	* Returns the name of the clock source.
+	*
+	* returns: name of clock source
+	*/
+	const char* getName();
+
+	/*
+	* Sets the reading of the clock.
+	*
+	* ticks: new reading
+	*/
+	void setTicks(long long ticks);
+
+	/*
+	* Moves the clock forward by the given number of ticks.
+	*
+	* ticks: number of ticks to advance
+	*/
+	void advance(long long ticks);
+};
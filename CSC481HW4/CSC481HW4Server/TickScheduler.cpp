@@ -0,0 +1,156 @@
+#include "TickScheduler.h"
+#include <thread>
+#include <chrono>
+#include <iostream>
+#include <cmath>
+
+#ifdef _WIN32
+#include <windows.h>
+#pragma comment(lib, "winmm.lib")
+#endif
+
+constexpr float TickScheduler::SPIN_MARGIN_SECONDS;
+constexpr float TickScheduler::OVERRUN_REPORT_INTERVAL_SECONDS;
+constexpr float TickScheduler::DEFAULT_TICKS_PER_SECOND;
+
+TickScheduler::TickScheduler(float ticksPerSecond, int maxCatchUpTicks, ClockSource* clockSource)
+{
+	this->clockSource = clockSource;
+	//start from a valid period, so an invalid rate below leaves one in place
+	tickPeriod = toClockTicks(1.f / DEFAULT_TICKS_PER_SECOND);
+	setTickRate(ticksPerSecond);
+	this->maxCatchUpTicks = maxCatchUpTicks > 0 ? maxCatchUpTicks : 1;
+	ticksRun = 0;
+	ticksSkipped = 0;
+	overrunsNum = 0;
+	unreportedTicksSkipped = 0;
+	unreportedOverrunsNum = 0;
+	nextTickTime = clockSource->readTicks();
+	firstDueTickTime = nextTickTime;
+	//allow the first overrun to be reported straight away
+	lastReportTime = nextTickTime - toClockTicks(OVERRUN_REPORT_INTERVAL_SECONDS);
+
+#ifdef _WIN32
+	//sleeps on Windows are rounded up to the system timer resolution (about 15.6 ms by default), which is longer than a tick
+	timeBeginPeriod(1);
+#endif
+}
+
+TickScheduler::~TickScheduler()
+{
+#ifdef _WIN32
+	timeEndPeriod(1);
+#endif
+}
+
+void TickScheduler::setTickRate(float ticksPerSecond)
+{
+	if (ticksPerSecond <= 0.f)
+	{
+		std::cerr << "Invalid tick rate: " + std::to_string(ticksPerSecond) << std::endl;
+		return;
+	}
+
+	//a period shorter than the clock can measure would never let the loop catch up
+	long long period = toClockTicks(1.f / ticksPerSecond);
+	tickPeriod = period > 0 ? period : 1;
+}
+
+float TickScheduler::getTickPeriod()
+{
+	return (float)((double)tickPeriod / clockSource->getTicksPerSecond());
+}
+
+int TickScheduler::waitForTicks()
+{
+	long long now = clockSource->readTicks();
+	if (now < nextTickTime)
+	{
+		waitUntil(nextTickTime);
+		now = clockSource->readTicks();
+	}
+
+	//every whole tick period we are past the deadline is another tick owed
+	long long ticksOwed = 1 + (now - nextTickTime) / tickPeriod;
+	if (ticksOwed > 1)
+	{
+		overrunsNum++;
+		unreportedOverrunsNum++;
+	}
+
+	//too far behind to catch up, so drop the oldest ticks and carry on from now
+	if (ticksOwed > maxCatchUpTicks)
+	{
+		long long skippedNum = ticksOwed - maxCatchUpTicks;
+		ticksSkipped += skippedNum;
+		unreportedTicksSkipped += skippedNum;
+		nextTickTime += tickPeriod * skippedNum;
+		ticksOwed = maxCatchUpTicks;
+	}
+
+	int ticksDue = (int)ticksOwed;
+	firstDueTickTime = nextTickTime;
+	nextTickTime += tickPeriod * ticksDue;
+	ticksRun += ticksDue;
+
+	reportOverruns(now);
+
+	return ticksDue;
+}
+
+long long TickScheduler::getDueTickTime(int tick)
+{
+	return firstDueTickTime + tickPeriod * tick;
+}
+
+void TickScheduler::waitUntil(long long deadline)
+{
+	long long sleepTicks = deadline - toClockTicks(SPIN_MARGIN_SECONDS) - clockSource->readTicks();
+	if (sleepTicks > 0)
+	{
+		std::this_thread::sleep_for(std::chrono::duration<double>((double)sleepTicks / clockSource->getTicksPerSecond()));
+	}
+	while (clockSource->readTicks() < deadline)
+	{
+		std::this_thread::yield();
+	}
+}
+
+long long TickScheduler::toClockTicks(float seconds)
+{
+	return llround((double)seconds * clockSource->getTicksPerSecond());
+}
+
+void TickScheduler::reportOverruns(long long now)
+{
+	if (unreportedOverrunsNum == 0 || now - lastReportTime < toClockTicks(OVERRUN_REPORT_INTERVAL_SECONDS))
+	{
+		return;
+	}
+
+	std::cerr << "Server tick overran " + std::to_string(unreportedOverrunsNum) + " time(s)";
+	if (unreportedTicksSkipped > 0)
+	{
+		std::cerr << ", skipping " + std::to_string(unreportedTicksSkipped) + " tick(s)";
+	}
+	std::cerr << std::endl;
+
+	unreportedOverrunsNum = 0;
+	unreportedTicksSkipped = 0;
+	lastReportTime = now;
+}
+
+unsigned long long TickScheduler::getTicksRun()
+{
+	return ticksRun;
+}
+
+unsigned long long TickScheduler::getTicksSkipped()
+{
+	return ticksSkipped;
+}
+
+unsigned long long TickScheduler::getOverrunsNum()
+{
+	return overrunsNum;
+}
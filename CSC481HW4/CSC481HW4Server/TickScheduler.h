@@ -0,0 +1,144 @@
+#pragma once
+#include "ClockSource.h"
+
+/*
+* Schedules the fixed-length ticks of a simulation loop. Ticks are due at fixed deadlines (start + n * tick period) rather than
+* after fixed sleeps, so the time taken by each tick's work never makes the loop drift. If the loop falls behind, the ticks it
+* missed are run back to back to catch up (up to a limit, past which they are skipped and reported so that an overloaded loop
+* doesn't spiral further behind). Time is read from the given clock source (the one timelines read), and each tick owed is
+* handed out with its own deadline, so a tick run late can freeze time at the moment it was due and catch-up ticks each
+* advance the simulation by exactly one tick period.
+*/
+class TickScheduler
+{
+	private:
+		/* how long before a deadline to stop sleeping and yield until it instead (sleeps can overshoot by about this much) */
+		static constexpr float SPIN_MARGIN_SECONDS = 0.001f;
+
+		/* minimum time between overrun reports */
+		static constexpr float OVERRUN_REPORT_INTERVAL_SECONDS = 1.f;
+
+		/* tick rate used until a valid one is set */
+		static constexpr float DEFAULT_TICKS_PER_SECOND = 60.f;
+
+		/* clock to schedule ticks by */
+		ClockSource* clockSource;
+
+		/* length of each tick (in the clock source's ticks) */
+		long long tickPeriod;
+
+		/* most ticks run back to back when catching up */
+		int maxCatchUpTicks;
+
+		/* deadline of the next tick (acts as the accumulator: how far past it we are is how much time is owed to ticks) */
+		long long nextTickTime;
+
+		/* deadline of the first of the ticks returned by the last wait */
+		long long firstDueTickTime;
+
+		/* total number of ticks run */
+		unsigned long long ticksRun;
+
+		/* total number of ticks skipped for being too far behind */
+		unsigned long long ticksSkipped;
+
+		/* total number of times the loop came back after its next tick was already due (its last tick overran) */
+		unsigned long long overrunsNum;
+
+		/* ticks skipped and overruns since the last report */
+		unsigned long long unreportedTicksSkipped;
+		unsigned long long unreportedOverrunsNum;
+
+		/* time of the last overrun report */
+		long long lastReportTime;
+
+		/*
+		* Blocks until the clock reaches the given reading. Sleeps for most of the wait, then yields for the last SPIN_MARGIN_SECONDS
+		* so that the wake up isn't late by the sleep's granularity.
+		*
+		* deadline: clock reading to wait for
+		*/
+		void waitUntil(long long deadline);
+
+		/*
+		* Converts a number of seconds to the clock source's ticks.
+		*
+		* seconds: time in seconds
+		*
+		* returns: time in clock ticks
+		*/
+		long long toClockTicks(float seconds);
+
+		/*
+		* Prints any unreported overruns and skipped ticks, at most once every OVERRUN_REPORT_INTERVAL_SECONDS.
+		*/
+		void reportOverruns(long long now);
+
+	public:
+		/*
+		* Constructs a scheduler whose first tick is due immediately. An invalid tick rate is reported and DEFAULT_TICKS_PER_SECOND
+		* is used instead.
+		* 
+		* ticksPerSecond: tick rate
+		* maxCatchUpTicks: most ticks to run back to back when behind (any more are skipped)
+		* clockSource: clock to schedule ticks by
+		*/
+		TickScheduler(float ticksPerSecond, int maxCatchUpTicks, ClockSource* clockSource);
+
+		/*
+		* Stops the scheduler (restoring the system timer resolution if the scheduler raised it).
+		*/
+		~TickScheduler();
+
+		/*
+		* Sets the tick rate, starting from the next tick. An invalid rate is reported and the current one kept.
+		* 
+		* ticksPerSecond: tick rate
+		*/
+		void setTickRate(float ticksPerSecond);
+
+		/*
+		* Returns the length of each tick.
+		* 
+		* returns: tick period in seconds
+		*/
+		float getTickPeriod();
+
+		/*
+		* Blocks until the next tick is due and returns how many ticks to run now: 1 normally, or more if the loop has fallen
+		* behind (capped at the catch-up limit, with any beyond it skipped).
+		* 
+		* returns: number of ticks to run
+		*/
+		int waitForTicks();
+
+		/*
+		* Returns the deadline of one of the ticks returned by the last wait, which is the time that tick should be run at.
+		* 
+		* tick: which of the ticks due (0 for the first)
+		* 
+		* returns: deadline of tick as a reading of the clock source
+		*/
+		long long getDueTickTime(int tick);
+
+		/*
+		* Returns the total number of ticks run.
+		* 
+		* returns: ticks run
+		*/
+		unsigned long long getTicksRun();
+
+		/*
+		* Returns the total number of ticks skipped for being too far behind.
+		* 
+		* returns: ticks skipped
+		*/
+		unsigned long long getTicksSkipped();
+
+		/*
+		* Returns the total number of times a tick overran into the next tick's deadline.
+		* 
+		* returns: number of overruns
+		*/
+		unsigned long long getOverrunsNum();
+};
@@ -1,41 +1,113 @@
-#include "Timeline.h"
-
-Timeline::Timeline(float tic)
-{
-	this->tic = tic;
-	paused = false;
-	lastPausedTime = 0.f;
-	elapsedPauseTime = 0.f;
-}
-
-void Timeline::pause()
-{
-	lastPausedTime = getTime();
-	paused = true;
-}
-
-void Timeline::unpause()
-{
-	paused = false;
-	elapsedPauseTime += (getTime() - lastPausedTime);
-}
-
-void Timeline::setTic(float tic)
-{
-	this->tic = tic;
-}
-
-float Timeline::getTic()
-{
-	return tic;
-}
-
-bool Timeline::isPaused()
-{
-	return paused;
-}
-
-float Timeline::getElapsedPauseTime()
-{
-	return elapsedPauseTime;
-}
+#include "Timeline.h"
+#include "TimelineGraph.h"
+#include "SteadyClockSource.h"
+
+ClockSource* Timeline::clockSource = nullptr;
+
+Timeline::Timeline(float tic, Timeline* anchor)
+{
+	this->tic = tic;
+	this->anchor = anchor;
+	paused = false;
+	lastPausedTime = 0.f;
+	elapsedPauseTime = 0.f;
+
+	//nothing published yet (tick numbers start at 1), so if constructed mid-tick, the first read publishes it
+	publishedTime = 0.f;
+	publishedTickNum = 0;
+	TimelineGraph::getGraph()->addTimeline(this);
+}
+
+Timeline::~Timeline()
+{
+	TimelineGraph::getGraph()->removeTimeline(this);
+}
+
+float Timeline::getTime()
+{
+	//if timeline is paused, return negative value
+	if (paused)
+	{
+		return -1.f;
+	}
+
+	TimelineGraph* graph = TimelineGraph::getGraph();
+	if (!graph->isFrozen())
+	{
+		return computeTime();
+	}
+
+	//read the time published for the tick (publishing it now if this timeline was constructed during the tick)
+	if (publishedTickNum != graph->getTickNum())
+	{
+		publishedTime = computeTime();
+		publishedTickNum = graph->getTickNum();
+	}
+	return publishedTime;
+}
+
+long long Timeline::now()
+{
+	TimelineGraph* graph = TimelineGraph::getGraph();
+	return graph->isFrozen() ? graph->getFrozenTicks() : getClockSource()->readTicks();
+}
+
+Timeline* Timeline::getAnchor()
+{
+	return anchor;
+}
+
+void Timeline::setClockSource(ClockSource* clockSource)
+{
+	Timeline::clockSource = clockSource;
+}
+
+ClockSource* Timeline::getClockSource()
+{
+	if (clockSource == nullptr)
+	{
+		clockSource = new SteadyClockSource();
+	}
+	return clockSource;
+}
+
+void Timeline::pause()
+{
+	lastPausedTime = getTime();
+	paused = true;
+
+	//timelines anchored to this one now see it paused
+	TimelineGraph::getGraph()->propagate(this);
+}
+
+void Timeline::unpause()
+{
+	paused = false;
+	elapsedPauseTime += (getTime() - lastPausedTime);
+
+	//time has shifted for this timeline (and anything anchored to it)
+	TimelineGraph::getGraph()->propagate(this);
+}
+
+void Timeline::setTic(float tic)
+{
+	this->tic = tic;
+
+	//time has been rescaled for this timeline (and anything anchored to it)
+	TimelineGraph::getGraph()->propagate(this);
+}
+
+float Timeline::getTic()
+{
+	return tic;
+}
+
+bool Timeline::isPaused()
+{
+	return paused;
+}
+
+float Timeline::getElapsedPauseTime()
+{
+	return elapsedPauseTime;
+}
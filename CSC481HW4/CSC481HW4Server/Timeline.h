@@ -1,71 +1,145 @@
-#pragma once
-/*
-* An abstract class that defines shared functionality for timelines with different representations of time.
-* A timeline is an explicit representation of time that enables performing actions based on changes in time and is able
-* to be paused and unpaused. The timeline's tic size can also be changed to speed up or slow down the timeline.
-*/
-class Timeline
-{
-private:
-	/* number of time units of the measurement used that correspond to one time unit for this timeline */
-	float tic;
-	/* whether the timeline is currently paused */
-	bool paused;
-	/* the last time at which the timeline was set to paused */
-	float lastPausedTime;
-	/* the total elapsed time that the timeline has spent paused */
-	float elapsedPauseTime;
-
-public:
-	/*
-	* Constructs a timeline with the given tic size that is unpaused to start.
-	*/
-	Timeline(float tic);
-
-	/*
-	* Function to be defined by subclasses that returns the total time elapsed based on the timeline's measurement
-	* and tic size (minus any time spent paused). If the timeline is currently paused, a negative value is
-	* returned to indicate no updates based on the timeline should be made.
-	*
-	* returns: total elapsed time, or a negative value if paused
-	*/
-	virtual float getTime() = 0;
-
-	/*
-	* Pauses the timeline.
-	*/
-	void pause();
-
-	/*
-	* Unpauses the timeline.
-	*/
-	void unpause();
-
-	/*
-	* Sets the tic size to the indicated value.
-	*
-	* tic: tic size to set
-	*/
-	void setTic(float tic);
-
-	/*
-	* Returns the current tic size.
-	*
-	* returns: current tic size
-	*/
-	float getTic();
-
-	/*
-	* Returns whether the timeline is currently paused.
-	*
-	* returns: true if timeline is paused, false otherwise
-	*/
-	bool isPaused();
-
-	/*
-	* Returns the total elapsed time that the timeline has spent paused.
-	*
-	* returns: total elapsed time spent paused
-	*/
-	float getElapsedPauseTime();
-};
+#pragma once
+#include <vector>
+#include "ClockSource.h"
+
+/*
+* An abstract class that defines shared functionality for timelines with different representations of time.
+* A timeline is an explicit representation of time that enables performing actions based on changes in time and is able
+* to be paused and unpaused. The timeline's tic size can also be changed to speed up or slow down the timeline.
+*
+* A timeline may be anchored to another timeline, measuring its time from the anchor's. Every timeline is part of the
+* TimelineGraph, which can freeze time for the length of a tick: the clock is read once when the tick begins, every timeline's
+* time is published from that reading in anchor order, and all reads during the tick return the published times. This keeps
+* every timestamp taken within a tick consistent, and makes reads during the tick safe from any thread as long as no timeline is
+* paused, unpaused or has its tic changed at the same time.
+*
+* Real time is read from a shared ClockSource (steady_clock by default) as 64-bit integer ticks.
+*/
+class Timeline
+{
+	friend class TimelineGraph;
+
+private:
+	/* clock source that real time is read from */
+	static ClockSource* clockSource;
+
+	/* timeline this timeline is anchored to (or nullptr if it measures time itself) */
+	Timeline* anchor;
+
+	/* timelines anchored to this one */
+	std::vector<Timeline*> children;
+
+	/* time of this timeline published for the current tick (ignoring whether it's paused) */
+	float publishedTime;
+
+	/* tick that publishedTime was published in */
+	unsigned long long publishedTickNum;
+
+	/* number of time units of the measurement used that correspond to one time unit for this timeline */
+	float tic;
+	/* whether the timeline is currently paused */
+	bool paused;
+	/* the last time at which the timeline was set to paused */
+	float lastPausedTime;
+	/* the total elapsed time that the timeline has spent paused */
+	float elapsedPauseTime;
+
+protected:
+	/*
+	* Function to be defined by subclasses that returns the total time elapsed based on the timeline's measurement
+	* and tic size (minus any time spent paused), without regard to whether the timeline is currently paused.
+	*
+	* returns: total elapsed time
+	*/
+	virtual float computeTime() = 0;
+
+	/*
+	* Returns the current reading of the clock source, or the reading the current tick is frozen at if time is frozen.
+	*
+	* returns: current clock reading in the clock source's ticks
+	*/
+	static long long now();
+
+	/*
+	* Returns the timeline this timeline is anchored to.
+	*
+	* returns: anchor timeline, or nullptr if none
+	*/
+	Timeline* getAnchor();
+
+public:
+	/*
+	* Constructs a timeline with the given tic size and anchor that is unpaused to start, and adds it to the TimelineGraph.
+	*
+	* tic: tic size
+	* anchor: timeline to measure time from (or nullptr if the timeline measures time itself)
+	*/
+	Timeline(float tic, Timeline* anchor);
+
+	/*
+	* Destroys the timeline, removing it from the TimelineGraph.
+	*/
+	virtual ~Timeline();
+
+	/*
+	* Returns the total time elapsed based on the timeline's measurement and tic size (minus any time spent paused). If
+	* the timeline is currently paused, a negative value is returned to indicate no updates based on the timeline should be
+	* made. While time is frozen, this is the time published for the tick.
+	*
+	* returns: total elapsed time, or a negative value if paused
+	*/
+	float getTime();
+
+	/*
+	* Sets the clock source that real time is read from. Timelines measuring real time take their starting reading from the
+	* clock source when constructed, so this should be set before any of them are.
+	*
+	* clockSource: clock source to read from
+	*/
+	static void setClockSource(ClockSource* clockSource);
+
+	/*
+	* Returns the clock source that real time is read from (creating the default steady_clock source if none has been set).
+	*
+	* returns: clock source in use
+	*/
+	static ClockSource* getClockSource();
+
+	/*
+	* Pauses the timeline.
+	*/
+	void pause();
+
+	/*
+	* Unpauses the timeline.
+	*/
+	void unpause();
+
+	/*
+	* Sets the tic size to the indicated value.
+	*
+	* tic: tic size to set
+	*/
+	void setTic(float tic);
+
+	/*
+	* Returns the current tic size.
+	*
+	* returns: current tic size
+	*/
+	float getTic();
+
+	/*
+	* Returns whether the timeline is currently paused.
+	*
+	* returns: true if timeline is paused, false otherwise
+	*/
+	bool isPaused();
+
+	/*
+	* Returns the total elapsed time that the timeline has spent paused.
+	*
+	* returns: total elapsed time spent paused
+	*/
+	float getElapsedPauseTime();
+};
@@ -0,0 +1,129 @@
+#include "TimelineGraph.h"
+#include "Timeline.h"
+#include <algorithm>
+
+TimelineGraph* TimelineGraph::graph = nullptr;
+
+TimelineGraph::TimelineGraph()
+{
+	orderDirty = false;
+	frozen = false;
+	frozenTicks = 0;
+	//published times start at tick 0, so tick numbers start at 1 to mark them stale
+	tickNum = 0;
+}
+
+TimelineGraph* TimelineGraph::getGraph()
+{
+	if (!graph)
+	{
+		graph = new TimelineGraph();
+	}
+
+	return graph;
+}
+
+void TimelineGraph::addTimeline(Timeline* timeline)
+{
+	if (timeline->anchor == nullptr)
+	{
+		roots.push_back(timeline);
+	}
+	else
+	{
+		timeline->anchor->children.push_back(timeline);
+	}
+	orderDirty = true;
+}
+
+void TimelineGraph::removeTimeline(Timeline* timeline)
+{
+	std::vector<Timeline*>& siblings = timeline->anchor == nullptr ? roots : timeline->anchor->children;
+	siblings.erase(std::remove(siblings.begin(), siblings.end(), timeline), siblings.end());
+	orderDirty = true;
+}
+
+void TimelineGraph::buildOrder()
+{
+	order.clear();
+	int rootsNum = roots.size();
+	for (int i = 0; i < rootsNum; i++)
+	{
+		appendSubtree(roots[i], order);
+	}
+	orderDirty = false;
+}
+
+void TimelineGraph::appendSubtree(Timeline* timeline, std::vector<Timeline*>& timelines)
+{
+	//walk breadth-first from the given timeline, which keeps every anchor ahead of the timelines anchored to it
+	size_t start = timelines.size();
+	timelines.push_back(timeline);
+	for (size_t i = start; i < timelines.size(); i++)
+	{
+		std::vector<Timeline*>& children = timelines[i]->children;
+		timelines.insert(timelines.end(), children.begin(), children.end());
+	}
+}
+
+void TimelineGraph::publish(Timeline* timeline)
+{
+	timeline->publishedTime = timeline->computeTime();
+	timeline->publishedTickNum = tickNum;
+}
+
+void TimelineGraph::beginTick(long long ticks)
+{
+	if (orderDirty)
+	{
+		buildOrder();
+	}
+
+	frozen = true;
+	frozenTicks = ticks;
+	tickNum++;
+
+	//each anchor is published before anything anchored to it reads it, so every timeline is computed exactly once
+	int timelinesNum = order.size();
+	for (int i = 0; i < timelinesNum; i++)
+	{
+		publish(order[i]);
+	}
+}
+
+void TimelineGraph::endTick()
+{
+	frozen = false;
+}
+
+void TimelineGraph::propagate(Timeline* timeline)
+{
+	if (!frozen)
+	{
+		return;
+	}
+
+	//only the changed timeline and the ones below it can be affected
+	std::vector<Timeline*> subtree;
+	appendSubtree(timeline, subtree);
+	int subtreeNum = subtree.size();
+	for (int i = 0; i < subtreeNum; i++)
+	{
+		publish(subtree[i]);
+	}
+}
+
+bool TimelineGraph::isFrozen()
+{
+	return frozen;
+}
+
+long long TimelineGraph::getFrozenTicks()
+{
+	return frozenTicks;
+}
+
+unsigned long long TimelineGraph::getTickNum()
+{
+	return tickNum;
+}
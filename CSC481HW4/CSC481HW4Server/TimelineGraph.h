@@ -0,0 +1,127 @@
+#pragma once
+#include <vector>
+
+class Timeline;
+
+/*
+* Keeps track of every timeline and the anchors they are built on, and evaluates them all once per tick. When a tick begins at a
+* clock reading, each timeline's time is computed from it in anchor order (roots first, then the timelines anchored to them),
+* so every timeline is computed exactly once from its anchor's already published time rather than walking its anchor chain on
+* every read. The published times are then what every read during the tick returns.
+*
+* When a timeline is paused, unpaused or has its tic changed during a tick, only it and the timelines anchored below it are
+* re-evaluated.
+*/
+class TimelineGraph
+{
+private:
+	/* sole instance of TimelineGraph */
+	static TimelineGraph* graph;
+
+	/* timelines without an anchor, in the order they were added */
+	std::vector<Timeline*> roots;
+
+	/* every timeline in anchor order (rebuilt when timelines are added or removed) */
+	std::vector<Timeline*> order;
+
+	/* whether order needs to be rebuilt */
+	bool orderDirty;
+
+	/* whether time is currently frozen for a tick */
+	bool frozen;
+
+	/* reading of the clock that the current tick is frozen at */
+	long long frozenTicks;
+
+	/* number of the current tick (incremented each time a tick begins) */
+	unsigned long long tickNum;
+
+	/*
+	* Constructs an empty graph with time unfrozen.
+	*/
+	TimelineGraph();
+
+	/*
+	* Rebuilds the anchor order of all timelines by walking down from the roots.
+	*/
+	void buildOrder();
+
+	/*
+	* Appends the given timeline and everything anchored below it to the given list, anchors first.
+	*
+	* timeline: timeline to start from
+	* timelines: list to append to
+	*/
+	static void appendSubtree(Timeline* timeline, std::vector<Timeline*>& timelines);
+
+	/*
+	* Computes and publishes the time of the given timeline for the current tick.
+	*
+	* timeline: timeline to evaluate
+	*/
+	void publish(Timeline* timeline);
+
+public:
+	/*
+	* Returns the sole instance of TimelineGraph.
+	*/
+	static TimelineGraph* getGraph();
+
+	/*
+	* Adds a timeline to the graph under its anchor (or as a root if it has none). Called by Timeline when constructed; since
+	* the timeline isn't fully constructed yet, it is evaluated on its first read if added during a tick.
+	*
+	* timeline: timeline to add
+	*/
+	void addTimeline(Timeline* timeline);
+
+	/*
+	* Removes a timeline from the graph. Timelines anchored to it should be removed first.
+	*
+	* timeline: timeline to remove
+	*/
+	void removeTimeline(Timeline* timeline);
+
+	/*
+	* Freezes time for a tick at the given clock reading, publishing every timeline's time from it in anchor order. Ticks run late
+	* (such as when catching up) are frozen at the time they were due rather than the live clock, so each still advances time by
+	* one tick period. Should be called from the thread running the ticks.
+	*
+	* ticks: clock reading to freeze the tick at (in the clock source's ticks)
+	*/
+	void beginTick(long long ticks);
+
+	/*
+	* Unfreezes time at the end of a tick, so reads go back to the live clock.
+	*/
+	void endTick();
+
+	/*
+	* Re-evaluates the given timeline and every timeline anchored below it (if time is frozen), after its state has changed
+	* during a tick.
+	*
+	* timeline: timeline whose state changed
+	*/
+	void propagate(Timeline* timeline);
+
+	/*
+	* Returns whether time is currently frozen for a tick.
+	*
+	* returns: true if time is frozen, false otherwise
+	*/
+	bool isFrozen();
+
+	/*
+	* Returns the reading of the clock that the current tick is frozen at.
+	*
+	* returns: frozen clock reading in the clock source's ticks
+	*/
+	long long getFrozenTicks();
+
+	/*
+	* Returns the number of the current tick (or the last one, if time isn't frozen).
+	*
+	* returns: tick number
+	*/
+	unsigned long long getTickNum();
+};
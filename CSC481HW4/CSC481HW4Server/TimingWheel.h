@@ -0,0 +1,288 @@
+#pragma once
+#include <vector>
+#include <map>
+#include <cmath>
+#include <cfloat>
+
+/*
+* A timing wheel used for scheduling items (such as events) at timeline times. Time is divided into fixed-size slots arranged in a
+* ring covering a limited horizon past the current time; inserting an item drops it straight into the slot for its timestamp, and
+* popping walks the ring forward as time passes, so both are O(1) (amortized for popping). Items scheduled past the horizon wait in
+* a sorted overflow and are moved into the ring once it reaches them, and items scheduled before the start of the ring (such as
+* events raised in the past to be handled first) go into a late list that is popped before anything else.
+*
+* Items within the same slot (or the late list) are popped in the order they were pushed rather than strictly by timestamp.
+*
+* Positions in the ring are tracked as whole slot numbers (a timestamp's slot is floor(timestamp / slotSize)) rather than as a
+* running float start time, so slots keep lining up with times however long the timeline has been running.
+*/
+template <typename T>
+class TimingWheel
+{
+	private:
+		/*
+		* An item along with the time at which it is due.
+		*/
+		struct Entry
+		{
+			float timestamp;
+			T item;
+		};
+
+		/*
+		* A FIFO list of entries. Popped entries are skipped over rather than erased, and storage is reused once the list empties,
+		* so a slot stops allocating once it has grown to fit its busiest tick.
+		*/
+		struct Slot
+		{
+			std::vector<Entry> entries;
+			size_t head = 0;
+
+			bool empty()
+			{
+				return head == entries.size();
+			}
+
+			void push(const Entry& entry)
+			{
+				entries.push_back(entry);
+			}
+
+			Entry& front()
+			{
+				return entries[head];
+			}
+
+			void pop()
+			{
+				head++;
+				if (head == entries.size())
+				{
+					entries.clear();
+					head = 0;
+				}
+			}
+		};
+
+		/* amount of time covered by each slot */
+		float slotSize;
+
+		/* slots making up the ring */
+		std::vector<Slot> slots;
+
+		/* index in the ring of the current slot */
+		int cursor;
+
+		/* slot number of the current slot */
+		long long baseTick;
+
+		/* items before the current slot, in the order they were pushed */
+		Slot late;
+
+		/* items past the end of the ring, sorted by timestamp (in push order for equal timestamps) */
+		std::multimap<float, T> overflow;
+
+		/* number of items in the ring (not counting late or overflow) */
+		int wheelNum;
+
+		/* total number of items */
+		int itemsNum;
+
+		/* latest time passed to popReady (used when re-anchoring an empty wheel) */
+		float lastTime;
+
+		/*
+		* Returns whether an item with the given timestamp is due at the given time.
+		*/
+		static bool isDue(float timestamp, float time)
+		{
+			return timestamp < time || fabs(time - timestamp) < FLT_EPSILON;
+		}
+
+		/*
+		* Returns the number of the slot containing the given time.
+		*/
+		long long tickOf(float time)
+		{
+			return (long long)floor((double)time / slotSize);
+		}
+
+		/*
+		* Returns the number of the first slot past the end of the ring.
+		*/
+		long long getHorizonTick()
+		{
+			return baseTick + (long long)slots.size();
+		}
+
+		/*
+		* Places the entry in the late list, the ring, or the overflow based on its timestamp.
+		*/
+		void place(const Entry& entry)
+		{
+			long long tick = tickOf(entry.timestamp);
+			if (tick < baseTick)
+			{
+				late.push(entry);
+			}
+			else if (tick < getHorizonTick())
+			{
+				int offset = (int)(tick - baseTick);
+				slots[(cursor + offset) % slots.size()].push(entry);
+				wheelNum++;
+			}
+			else
+			{
+				overflow.insert(std::pair<float, T>(entry.timestamp, entry.item));
+			}
+		}
+
+		/*
+		* Moves any overflow items that the ring now covers into the ring.
+		*/
+		void cascade()
+		{
+			long long horizonTick = getHorizonTick();
+			while (!overflow.empty() && tickOf(overflow.begin()->first) < horizonTick)
+			{
+				Entry entry = { overflow.begin()->first, overflow.begin()->second };
+				overflow.erase(overflow.begin());
+				place(entry);
+			}
+		}
+
+		/*
+		* Moves the start of the ring to the slot containing the given time. Only valid while the ring itself is empty.
+		*/
+		void anchor(float time)
+		{
+			baseTick = tickOf(time);
+			cursor = 0;
+		}
+
+	public:
+		/*
+		* Constructs an empty wheel with the given resolution and number of slots.
+		*
+		* slotSize: amount of time covered by each slot
+		* slotsNum: number of slots (slotSize * slotsNum is how far ahead items can be scheduled before going to the overflow)
+		*/
+		TimingWheel(float slotSize, int slotsNum)
+		{
+			this->slotSize = slotSize;
+			slots.resize(slotsNum);
+			cursor = 0;
+			baseTick = 0;
+			wheelNum = 0;
+			itemsNum = 0;
+			lastTime = 0.f;
+		}
+
+		/*
+		* Schedules the item at the given time.
+		*
+		* timestamp: time at which the item is due
+		* item: item to schedule
+		*/
+		void push(float timestamp, T item)
+		{
+			//if nothing is scheduled, start the ring at the earlier of the new item and the last time we popped at, so that a
+			//wheel that is reused from an earlier time (such as for a new replay) doesn't treat everything as late
+			if (itemsNum == 0)
+			{
+				anchor(timestamp < lastTime ? timestamp : lastTime);
+			}
+
+			Entry entry = { timestamp, item };
+			place(entry);
+			itemsNum++;
+		}
+
+		/*
+		* Pops the next item that is due at the given time, if any.
+		*
+		* time: current time
+		* item: set to the popped item
+		*
+		* returns: true if an item was popped, false if nothing is due yet
+		*/
+		bool popReady(float time, T& item)
+		{
+			lastTime = time;
+
+			//anything scheduled before the ring started comes first
+			if (!late.empty())
+			{
+				if (!isDue(late.front().timestamp, time))
+				{
+					return false;
+				}
+
+				item = late.front().item;
+				late.pop();
+				itemsNum--;
+				return true;
+			}
+
+			while (itemsNum > 0)
+			{
+				//if only the overflow has items, jump the ring ahead to the earliest of them (but never past the current time)
+				if (wheelNum == 0)
+				{
+					float earliest = overflow.begin()->first;
+					if (tickOf(earliest) > baseTick + 1)
+					{
+						anchor(earliest < time ? earliest : time);
+					}
+					cascade();
+				}
+
+				Slot& slot = slots[cursor];
+				if (!slot.empty())
+				{
+					if (!isDue(slot.front().timestamp, time))
+					{
+						return false;
+					}
+
+					item = slot.front().item;
+					slot.pop();
+					wheelNum--;
+					itemsNum--;
+					return true;
+				}
+
+				//current slot is used up, so advance to the next one if its time has come
+				if (tickOf(time) <= baseTick)
+				{
+					return false;
+				}
+
+				cursor = (cursor + 1) % slots.size();
+				baseTick++;
+				cascade();
+			}
+
+			return false;
+		}
+
+		/*
+		* Returns whether any items are scheduled.
+		*
+		* returns: true if no items are scheduled, false otherwise
+		*/
+		bool empty()
+		{
+			return itemsNum == 0;
+		}
+
+		/*
+		* Returns the number of items scheduled.
+		*
+		* returns: number of scheduled items
+		*/
+		int size()
+		{
+			return itemsNum;
+		}
+};
@@ -0,0 +1,61 @@
+#include "Transform.h"
+#include "LocationInSpace.h"
+
+Transform::Transform(float x, float y, float width, float height, unsigned int color)
+{
+	this->x = x;
+	this->y = y;
+	this->width = width;
+	this->height = height;
+	this->color = color;
+	owner = nullptr;
+	objectId = -1;
+}
+
+void Transform::notifyOwner(float previousX, float previousY)
+{
+	if (owner != nullptr)
+	{
+		owner->onObjectMoved(objectId, previousX, previousY);
+	}
+}
+
+void Transform::setOwner(LocationInSpace* owner, int objectId)
+{
+	this->owner = owner;
+	this->objectId = objectId;
+}
+
+void Transform::setPosition(float x, float y)
+{
+	//nothing to track if position isn't actually changing
+	if (x == this->x && y == this->y)
+	{
+		return;
+	}
+
+	float previousX = this->x;
+	float previousY = this->y;
+	this->x = x;
+	this->y = y;
+	notifyOwner(previousX, previousY);
+}
+
+void Transform::move(float offsetX, float offsetY)
+{
+	if (offsetX == 0.f && offsetY == 0.f)
+	{
+		return;
+	}
+
+	float previousX = x;
+	float previousY = y;
+	x += offsetX;
+	y += offsetY;
+	notifyOwner(previousX, previousY);
+}
+
+unsigned int Transform::getColor()
+{
+	return color;
+}
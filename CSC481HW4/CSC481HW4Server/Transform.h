@@ -0,0 +1,167 @@
+#pragma once
+
+class LocationInSpace;
+
+/*
+* An object's position and extent in the world, owned by the engine rather than by any rendering library. The position is the
+* top-left corner of the object and the extent is the size of its axis-aligned bounding box, so collision checks only ever
+* compare plain floats. The server works entirely in terms of these; clients keep an sf::Shape per object as a render view (see
+* Rendering) and copy the position into it when drawing.
+*
+* The fill color isn't used by the engine itself, but is carried along so the server can tell clients how to build each
+* object's render view.
+*
+* Position should only be changed through setPosition and move, which let the LocationInSpace holding the transform know so it
+* can keep its cached bounds and its record of what moved this tick up to date.
+*/
+class Transform
+{
+	public:
+		/*
+		* An axis-aligned bounding box.
+		*/
+		struct Bounds
+		{
+			float left;
+			float top;
+			float width;
+			float height;
+
+			/*
+			* Returns whether this box overlaps the given one. Boxes that only touch along an edge don't overlap.
+			*
+			* other: box to check against
+			*
+			* returns: true if the boxes overlap, false otherwise
+			*/
+			bool intersects(const Bounds& other) const
+			{
+				return left < other.left + other.width && other.left < left + width
+					&& top < other.top + other.height && other.top < top + height;
+			}
+		};
+
+	private:
+		/* x coordinate of top-left corner */
+		float x;
+
+		/* y coordinate of top-left corner */
+		float y;
+
+		/* width of bounding box */
+		float width;
+
+		/* height of bounding box */
+		float height;
+
+		/* fill color as a 32-bit RGBA value (as given by sf::Color::toInteger) */
+		unsigned int color;
+
+		/* LocationInSpace holding this transform, told whenever it moves (or nullptr if none) */
+		LocationInSpace* owner;
+
+		/* id of the object this transform belongs to in owner */
+		int objectId;
+
+		/*
+		* Lets the owner know that the position has just changed.
+		*
+		* previousX: x coordinate before the change
+		* previousY: y coordinate before the change
+		*/
+		void notifyOwner(float previousX, float previousY);
+
+	public:
+		/*
+		* Constructs a Transform with the given values.
+		*
+		* x: x coordinate of top-left corner
+		* y: y coordinate of top-left corner
+		* width: width of bounding box
+		* height: height of bounding box
+		* color: fill color as a 32-bit RGBA value
+		*/
+		Transform(float x, float y, float width, float height, unsigned int color);
+
+		/*
+		* Returns the x coordinate of the top-left corner.
+		*
+		* returns: x coordinate
+		*/
+		float getX()
+		{
+			return x;
+		}
+
+		/*
+		* Returns the y coordinate of the top-left corner.
+		*
+		* returns: y coordinate
+		*/
+		float getY()
+		{
+			return y;
+		}
+
+		/*
+		* Sets the LocationInSpace to tell whenever this transform moves. A transform can only be held by one LocationInSpace at a
+		* time; LocationInSpace sets this itself when objects are added and removed.
+		*
+		* owner: LocationInSpace holding this transform (or nullptr if none)
+		* objectId: id of the object this transform belongs to in owner
+		*/
+		void setOwner(LocationInSpace* owner, int objectId);
+
+		/*
+		* Moves the top-left corner to the given position.
+		*
+		* x: new x coordinate
+		* y: new y coordinate
+		*/
+		void setPosition(float x, float y);
+
+		/*
+		* Moves the object by the given offset.
+		*
+		* offsetX: amount to move in x direction
+		* offsetY: amount to move in y direction
+		*/
+		void move(float offsetX, float offsetY);
+
+		/*
+		* Returns the width of the bounding box.
+		*
+		* returns: width
+		*/
+		float getWidth()
+		{
+			return width;
+		}
+
+		/*
+		* Returns the height of the bounding box.
+		*
+		* returns: height
+		*/
+		float getHeight()
+		{
+			return height;
+		}
+
+		/*
+		* Returns the object's bounding box in world coordinates.
+		*
+		* returns: bounding box
+		*/
+		Bounds getBounds()
+		{
+			return { x, y, width, height };
+		}
+
+		/*
+		* Returns the fill color.
+		*
+		* returns: fill color as a 32-bit RGBA value
+		*/
+		unsigned int getColor();
+};
@@ -0,0 +1,50 @@
+#include "TscClockSource.h"
+#include <chrono>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define HAS_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAS_TSC
+#endif
+
+constexpr double TscClockSource::CALIBRATION_SECONDS;
+
+TscClockSource::TscClockSource()
+{
+#ifdef HAS_TSC
+    //count how many counter ticks pass over a stretch of steady_clock time
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    long long startTicks = readTicks();
+    std::chrono::steady_clock::time_point endTime;
+    do
+    {
+        endTime = std::chrono::steady_clock::now();
+    } while (std::chrono::duration<double>(endTime - startTime).count() < CALIBRATION_SECONDS);
+    long long endTicks = readTicks();
+
+    ticksPerSecond = (long long)((endTicks - startTicks) / std::chrono::duration<double>(endTime - startTime).count());
+#else
+    ticksPerSecond = (long long)(std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num);
+#endif
+}
+
+long long TscClockSource::readTicks()
+{
+#ifdef HAS_TSC
+    return (long long)__rdtsc();
+#else
+    return (long long)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+long long TscClockSource::getTicksPerSecond()
+{
+    return ticksPerSecond;
+}
+
+const char* TscClockSource::getName()
+{
+    return "tsc";
+}
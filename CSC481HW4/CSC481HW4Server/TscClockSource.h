@@ -0,0 +1,46 @@
+#pragma once
+#include "ClockSource.h"
+
+/*
+* A clock source reading the processor's time stamp counter directly. This is the cheapest precise clock available (a single
+* instruction, with no call into the operating system), but its rate isn't reported by the hardware, so it is calibrated
+* against steady_clock when constructed. Assumes an invariant TSC (one that ticks at a constant rate across cores and power
+* states), which every x86 processor of the last decade has. Falls back to steady_clock on other architectures.
+*/
+class TscClockSource :
+	public ClockSource
+{
+private:
+	/* measured number of time stamp counter ticks per second */
+	long long ticksPerSecond;
+
+	/* how long to spend calibrating against steady_clock, in seconds */
+	static constexpr double CALIBRATION_SECONDS = 0.05;
+
+public:
+	/*
+	* Constructs the clock source, calibrating the counter's rate against steady_clock (which takes CALIBRATION_SECONDS).
+	*/
+	TscClockSource();
+
+	/*
+	* Returns the current reading of the time stamp counter.
+	*
+	* returns: number of counter ticks since the processor was reset
+	*/
+	long long readTicks();
+
+	/*
+	* Returns the calibrated number of counter ticks that make up a second.
+	*
+	* returns: ticks per second
+	*/
+	long long getTicksPerSecond();
+
+	/*
+	* Returns the name of the clock source.
+	*
+	* returns: name of clock source
+	*/
+	const char* getName();
+};
@@ -1,172 +1,211 @@
-#include "UserInputHandler.h"
-
-UserInputHandler::UserInputHandler(std::map<int, Property*>* propertyMap, bool notifyWhileReplaying,
-	int playerDirectedMovementId, int locationInSpaceId) 
-	: EventHandler(propertyMap, notifyWhileReplaying)
-{
-	this->playerDirectedMovementId = playerDirectedMovementId;
-	this->locationInSpaceId = locationInSpaceId;
-}
-
-void UserInputHandler::onEvent(Event* e)
-{
-	//if there is user input for movement or character is continuing to jump, process the movement
-	if (e->getType() == ClientServerConsts::USER_INPUT_EVENT || e->getType() == ClientServerConsts::CHARACTER_STILL_JUMPING_EVENT)
-	{
-		//get id of character corresponding to client
-		int characterId = e->getArgument(0).argValue.argAsInt;
-
-		//get PlayerDirectedMovement and LocationInSpace
-		PlayerDirectedMovement* playerDirectedMovement = (PlayerDirectedMovement*) propertyMap->at(playerDirectedMovementId);
-		LocationInSpace* locationInSpace = (LocationInSpace*)propertyMap->at(locationInSpaceId);
-
-		//make sure character still exists (could have disconnected)
-		if (playerDirectedMovement->hasObject(characterId) && locationInSpace->hasObject(characterId))
-		{
-			//get whether character is currently jumping
-			bool wasJumping = playerDirectedMovement->isJumpingUp(characterId);
-
-			//get initial positions of character
-			sf::Shape* charShape = locationInSpace->getObjectShape(characterId);
-			float initialX = charShape->getPosition().x;
-			float initialY = charShape->getPosition().y;
-
-			//if there is movement from user input, get the key and process the movement
-			//or if key says to start or stop recording a replay, send appropriate event
-			if (e->getType() == ClientServerConsts::USER_INPUT_EVENT)
-			{
-				int keyType = e->getArgument(1).argValue.argAsInt;
-
-				if (keyType == ClientServerConsts::LEFT_ARROW_KEY)
-				{
-					playerDirectedMovement->processMovement(characterId, sf::Keyboard::Left);
-				}
-				else if (keyType == ClientServerConsts::RIGHT_ARROW_KEY)
-				{
-					playerDirectedMovement->processMovement(characterId, sf::Keyboard::Right);
-				}
-				else if (keyType == ClientServerConsts::UP_ARROW_KEY)
-				{
-					playerDirectedMovement->processMovement(characterId, sf::Keyboard::Up);
-				}
-				else if (keyType == ClientServerConsts::R_KEY)
-				{
-					Event* replayRecordingStartEvent = new Event(EventManager::getManager()->getCurrentTime(),
-						ClientServerConsts::REPLAY_RECORDING_START_EVENT, {});
-					EventManager::getManager()->raise(replayRecordingStartEvent);
-					return;
-				}
-				else if (keyType == ClientServerConsts::ONE_KEY)
-				{
-					struct Event::ArgumentVariant replaySpeedArg;
-					replaySpeedArg.argType = Event::ArgumentType::TYPE_FLOAT;
-					replaySpeedArg.argValue.argAsFloat = 2.f;
-					Event* replayRecordingStopEvent = new Event(EventManager::getManager()->getCurrentTime(),
-						ClientServerConsts::REPLAY_RECORDING_STOP_EVENT, { replaySpeedArg });
-					EventManager::getManager()->raise(replayRecordingStopEvent);
-					return;
-				}
-				else if (keyType == ClientServerConsts::TWO_KEY)
-				{
-					struct Event::ArgumentVariant replaySpeedArg;
-					replaySpeedArg.argType = Event::ArgumentType::TYPE_FLOAT;
-					replaySpeedArg.argValue.argAsFloat = 1.f;
-					Event* replayRecordingStopEvent = new Event(EventManager::getManager()->getCurrentTime(),
-						ClientServerConsts::REPLAY_RECORDING_STOP_EVENT, { replaySpeedArg });
-					EventManager::getManager()->raise(replayRecordingStopEvent);
-					return;
-				}
-				else if (keyType == ClientServerConsts::THREE_KEY)
-				{
-					struct Event::ArgumentVariant replaySpeedArg;
-					replaySpeedArg.argType = Event::ArgumentType::TYPE_FLOAT;
-					replaySpeedArg.argValue.argAsFloat = 0.5f;
-					Event* replayRecordingStopEvent = new Event(EventManager::getManager()->getCurrentTime(),
-						ClientServerConsts::REPLAY_RECORDING_STOP_EVENT, { replaySpeedArg });
-					EventManager::getManager()->raise(replayRecordingStopEvent);
-					return;
-				}
-			}
-			//if movement is character still jumping, process movement without a specific key
-			else if (e->getType() == ClientServerConsts::CHARACTER_STILL_JUMPING_EVENT)
-			{
-				playerDirectedMovement->processMovement(characterId);
-			}
-
-			//record new positions
-			float newX = charShape->getPosition().x;
-			float newY = charShape->getPosition().y;
-
-			//raise movement event
-			struct Event::ArgumentVariant objectIdArg = { Event::ArgumentType::TYPE_INTEGER, characterId };
-			struct Event::ArgumentVariant locationInSpaceIdArg = { Event::ArgumentType::TYPE_INTEGER, locationInSpaceId };
-			struct Event::ArgumentVariant xArg;
-			xArg.argType = Event::ArgumentType::TYPE_FLOAT;
-			xArg.argValue.argAsFloat = newX - initialX;
-			struct Event::ArgumentVariant yArg;
-			yArg.argType = Event::ArgumentType::TYPE_FLOAT;
-			yArg.argValue.argAsFloat = newY - initialY;
-			struct Event::ArgumentVariant absoluteXArg;
-			absoluteXArg.argType = Event::ArgumentType::TYPE_FLOAT;
-			absoluteXArg.argValue.argAsFloat = newX;
-			struct Event::ArgumentVariant absoluteYArg;
-			absoluteYArg.argType = Event::ArgumentType::TYPE_FLOAT;
-			absoluteYArg.argValue.argAsFloat = newY;
-			Event* characterMovementEvent = new Event(EventManager::getManager()->getCurrentTime(), ClientServerConsts::CHARACTER_MOVED_EVENT,
-				{ objectIdArg, locationInSpaceIdArg, xArg, yArg, absoluteXArg, absoluteYArg });
-			EventManager::getManager()->raise(characterMovementEvent);
-
-			//see whether character is jumping after processing movement
-			bool isJumping = playerDirectedMovement->isJumpingUp(characterId);
-
-			//if character is jumping, check to see whether we just started jumping and raise appropriate events
-			if (isJumping)
-			{
-				if (!wasJumping)
-				{
-					struct Event::ArgumentVariant characterIdArg = { Event::ArgumentType::TYPE_INTEGER, characterId };
-					Event* startedJumpingEvent = new Event(EventManager::getManager()->getCurrentTime(),
-						ClientServerConsts::CHARACTER_JUMP_START_EVENT, { characterIdArg });
-					EventManager::getManager()->raise(startedJumpingEvent);
-				}
-
-				struct Event::ArgumentVariant characterIdArg = { Event::ArgumentType::TYPE_INTEGER, characterId };
-				Event* stillJumpingEvent = new Event(EventManager::getManager()->getCurrentTime() + 100.f,
-					ClientServerConsts::CHARACTER_STILL_JUMPING_EVENT, { characterIdArg });
-				EventManager::getManager()->raise(stillJumpingEvent);
-			}
-			//if character has stopped jumping, raise appropriate event
-			else if (wasJumping && !isJumping)
-			{
-				struct Event::ArgumentVariant characterIdArg = { Event::ArgumentType::TYPE_INTEGER, characterId };
-				Event* stoppedJumpingEvent = new Event(EventManager::getManager()->getCurrentTime(),
-					ClientServerConsts::CHARACTER_JUMP_END_EVENT, { characterIdArg });
-				EventManager::getManager()->raise(stoppedJumpingEvent);
-			}
-		}
-	}
-	//if character has started falling, set that value
-	else if (e->getType() == ClientServerConsts::CHARACTER_FALL_START_EVENT)
-	{
-		int characterId = e->getArgument(0).argValue.argAsInt;
-		PlayerDirectedMovement* playerDirectedMovement = (PlayerDirectedMovement*)propertyMap->at(playerDirectedMovementId);
-
-		//make sure character still exists (could have disconnected)
-		if (playerDirectedMovement->hasObject(characterId))
-		{
-			playerDirectedMovement->setFallingDown(characterId, true);
-		}
-	}
-	//if character has stopped falling, set that value
-	else if (e->getType() == ClientServerConsts::CHARACTER_FALL_END_EVENT)
-	{
-		int characterId = e->getArgument(0).argValue.argAsInt;
-		PlayerDirectedMovement* playerDirectedMovement = (PlayerDirectedMovement*)propertyMap->at(playerDirectedMovementId);
-
-		//make sure character still exists (could have disconnected)
-		if (playerDirectedMovement->hasObject(characterId))
-		{
-			playerDirectedMovement->setFallingDown(characterId, false);
-		}
-	}
-}
+#include "UserInputHandler.h"
+
+UserInputHandler::UserInputHandler(PropertyRegistry* propertyRegistry, bool notifyWhileReplaying,
+	int playerDirectedMovementId, int locationInSpaceId) 
+	: EventHandler(propertyRegistry, notifyWhileReplaying)
+{
+	this->playerDirectedMovementId = playerDirectedMovementId;
+	this->locationInSpaceId = locationInSpaceId;
+
+	//look up properties now rather than on every event
+	playerDirectedMovement = propertyRegistry->get<PlayerDirectedMovement>(playerDirectedMovementId);
+	locationInSpace = propertyRegistry->get<LocationInSpace>(locationInSpaceId);
+}
+
+void UserInputHandler::onEvent(Event* e)
+{
+	switch (e->getType())
+	{
+	//if there is user input for movement, process the movement
+	case ClientServerConsts::USER_INPUT_EVENT:
+	{
+		//get id of character corresponding to client
+		int characterId = e->getPayload<EventSchemas::UserInput>().characterId;
+
+		//make sure character still exists (could have disconnected)
+		if (playerDirectedMovement->hasObject(characterId) && locationInSpace->hasObject(characterId))
+		{
+			//if character is still spending time on its last movement, handle this movement again once it's done (rather than
+			//waiting for it here)
+			int keyType = e->getPayload<EventSchemas::UserInput>().keyType;
+			bool isMovement = keyType == ClientServerConsts::LEFT_ARROW_KEY || keyType == ClientServerConsts::RIGHT_ARROW_KEY
+				|| keyType == ClientServerConsts::UP_ARROW_KEY;
+			float timeUntilReady = playerDirectedMovement->getTimeUntilReady(characterId);
+			if (isMovement && timeUntilReady > 0.f)
+			{
+				Event* deferredEvent = EventManager::getManager()->createEvent(EventManager::getManager()->getCurrentTime() + timeUntilReady,
+					e->getType(), e->getPayloadData(), e->getPayloadSize());
+				EventManager::getManager()->raise(deferredEvent);
+				return;
+			}
+
+			//get whether character is currently jumping
+			bool wasJumping = playerDirectedMovement->isJumpingUp(characterId);
+
+			//get initial positions of character
+			Transform* charTransform = locationInSpace->getObjectTransform(characterId);
+			float initialX = charTransform->getX();
+			float initialY = charTransform->getY();
+
+			//if there is movement from user input, process the movement
+			//or if key says to start or stop recording a replay, send appropriate event
+			{
+				if (keyType == ClientServerConsts::LEFT_ARROW_KEY)
+				{
+					playerDirectedMovement->processMovement(characterId, sf::Keyboard::Left);
+				}
+				else if (keyType == ClientServerConsts::RIGHT_ARROW_KEY)
+				{
+					playerDirectedMovement->processMovement(characterId, sf::Keyboard::Right);
+				}
+				else if (keyType == ClientServerConsts::UP_ARROW_KEY)
+				{
+					playerDirectedMovement->processMovement(characterId, sf::Keyboard::Up);
+				}
+				else if (keyType == ClientServerConsts::R_KEY)
+				{
+					Event* replayRecordingStartEvent = EventManager::getManager()->createEvent(EventManager::getManager()->getCurrentTime(),
+						ClientServerConsts::REPLAY_RECORDING_START_EVENT, EventSchemas::NoArguments());
+					EventManager::getManager()->raise(replayRecordingStartEvent);
+					return;
+				}
+				else if (keyType == ClientServerConsts::ONE_KEY)
+				{
+					EventSchemas::ReplayRecordingStop replayRecordingStop = { 2.f };
+					Event* replayRecordingStopEvent = EventManager::getManager()->createEvent(EventManager::getManager()->getCurrentTime(),
+						ClientServerConsts::REPLAY_RECORDING_STOP_EVENT, replayRecordingStop);
+					EventManager::getManager()->raise(replayRecordingStopEvent);
+					return;
+				}
+				else if (keyType == ClientServerConsts::TWO_KEY)
+				{
+					EventSchemas::ReplayRecordingStop replayRecordingStop = { 1.f };
+					Event* replayRecordingStopEvent = EventManager::getManager()->createEvent(EventManager::getManager()->getCurrentTime(),
+						ClientServerConsts::REPLAY_RECORDING_STOP_EVENT, replayRecordingStop);
+					EventManager::getManager()->raise(replayRecordingStopEvent);
+					return;
+				}
+				else if (keyType == ClientServerConsts::THREE_KEY)
+				{
+					EventSchemas::ReplayRecordingStop replayRecordingStop = { 0.5f };
+					Event* replayRecordingStopEvent = EventManager::getManager()->createEvent(EventManager::getManager()->getCurrentTime(),
+						ClientServerConsts::REPLAY_RECORDING_STOP_EVENT, replayRecordingStop);
+					EventManager::getManager()->raise(replayRecordingStopEvent);
+					return;
+				}
+			}
+
+			//record new positions
+			float newX = charTransform->getX();
+			float newY = charTransform->getY();
+
+			//raise movement event
+			EventSchemas::Movement movement = { characterId, locationInSpaceId, newX - initialX, newY - initialY, newX, newY };
+			Event* characterMovementEvent = EventManager::getManager()->createEvent(EventManager::getManager()->getCurrentTime(),
+				ClientServerConsts::CHARACTER_MOVED_EVENT, movement);
+			EventManager::getManager()->raise(characterMovementEvent);
+
+			//see whether character is jumping after processing movement
+			bool isJumping = playerDirectedMovement->isJumpingUp(characterId);
+
+			//if character just started jumping, raise appropriate event and carry out the rest of the jump over time
+			if (isJumping && !wasJumping)
+			{
+				EventSchemas::CharacterStateChange stateChange = { characterId };
+				Event* startedJumpingEvent = EventManager::getManager()->createEvent(EventManager::getManager()->getCurrentTime(),
+					ClientServerConsts::CHARACTER_JUMP_START_EVENT, stateChange);
+				EventManager::getManager()->raise(startedJumpingEvent);
+
+				jumpNums[characterId]++;
+				performJump(characterId, jumpNums[characterId]);
+			}
+			//if character has stopped jumping, raise appropriate event
+			else if (wasJumping && !isJumping)
+			{
+				EventSchemas::CharacterStateChange stateChange = { characterId };
+				Event* stoppedJumpingEvent = EventManager::getManager()->createEvent(EventManager::getManager()->getCurrentTime(),
+					ClientServerConsts::CHARACTER_JUMP_END_EVENT, stateChange);
+				EventManager::getManager()->raise(stoppedJumpingEvent);
+			}
+		}
+		break;
+	}
+	//if character has started falling, set that value
+	case ClientServerConsts::CHARACTER_FALL_START_EVENT:
+	{
+		int characterId = e->getPayload<EventSchemas::CharacterStateChange>().characterId;
+		//make sure character still exists (could have disconnected)
+		if (playerDirectedMovement->hasObject(characterId))
+		{
+			playerDirectedMovement->setFallingDown(characterId, true);
+		}
+		break;
+	}
+	//if character has stopped falling, set that value
+	case ClientServerConsts::CHARACTER_FALL_END_EVENT:
+	{
+		int characterId = e->getPayload<EventSchemas::CharacterStateChange>().characterId;
+		//make sure character still exists (could have disconnected)
+		if (playerDirectedMovement->hasObject(characterId))
+		{
+			playerDirectedMovement->setFallingDown(characterId, false);
+		}
+		break;
+	}
+	}
+}
+
+bool UserInputHandler::isCurrentJump(int characterId, unsigned long long jumpNum)
+{
+	return playerDirectedMovement->hasObject(characterId) && locationInSpace->hasObject(characterId)
+		&& playerDirectedMovement->isJumpingUp(characterId) && jumpNums[characterId] == jumpNum;
+}
+
+Behavior UserInputHandler::performJump(int characterId, unsigned long long jumpNum)
+{
+	while (true)
+	{
+		co_await EventManager::getManager()->waitFor(JUMP_STEP_DELAY);
+
+		//if character is still spending time on its last movement, wait until it's done
+		while (isCurrentJump(characterId, jumpNum) && playerDirectedMovement->getTimeUntilReady(characterId) > 0.f)
+		{
+			co_await EventManager::getManager()->waitFor(playerDirectedMovement->getTimeUntilReady(characterId));
+		}
+
+		//stop if character no longer exists (could have disconnected) or this jump has already ended (e.g. by a movement
+		//colliding partway through it)
+		if (!isCurrentJump(characterId, jumpNum))
+		{
+			co_return;
+		}
+
+		//get initial positions of character
+		Transform* charTransform = locationInSpace->getObjectTransform(characterId);
+		float initialX = charTransform->getX();
+		float initialY = charTransform->getY();
+
+		//progress jump
+		playerDirectedMovement->processMovement(characterId);
+
+		//record new positions
+		float newX = charTransform->getX();
+		float newY = charTransform->getY();
+
+		//raise movement event
+		EventSchemas::Movement movement = { characterId, locationInSpaceId, newX - initialX, newY - initialY, newX, newY };
+		Event* characterMovementEvent = EventManager::getManager()->createEvent(EventManager::getManager()->getCurrentTime(),
+			ClientServerConsts::CHARACTER_MOVED_EVENT, movement);
+		EventManager::getManager()->raise(characterMovementEvent);
+
+		//if character has stopped jumping, raise appropriate event and finish
+		if (!playerDirectedMovement->isJumpingUp(characterId))
+		{
+			EventSchemas::CharacterStateChange stateChange = { characterId };
+			Event* stoppedJumpingEvent = EventManager::getManager()->createEvent(EventManager::getManager()->getCurrentTime(),
+				ClientServerConsts::CHARACTER_JUMP_END_EVENT, stateChange);
+			EventManager::getManager()->raise(stoppedJumpingEvent);
+			co_return;
+		}
+	}
+}
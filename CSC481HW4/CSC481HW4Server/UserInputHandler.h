@@ -1,39 +1,71 @@
-#pragma once
-#include "EventHandler.h"
-#include "ClientServerConsts.h"
-#include "PlayerDirectedMovement.h"
-#include "LocationInSpace.h"
-#include "EventManager.h"
-/*
-* Event handler that handles inputs from the user.
-*/
-class UserInputHandler :
-    public EventHandler
-{
-    private:
-        /* id of PlayerDirectedMovement property to use for performing character movements */
-        int playerDirectedMovementId;
-
-        /* id of LocationInSpace property to use in checking character positions*/
-        int locationInSpaceId;
-
-    public:
-        /*
-        * Constructs a UserInputHandler with the given values.
-        * 
-        * propertyMap: map of all properties
-        * notifyWhileReplaying: whether to notify this handler of events while a replay is being played
-        * playerDirectedMovementId: id of PlayerDirectedMovement property to use in performing character movements
-        * locationInSpaceId: id of LocationInSpace property to use in checking character positions
-        */
-        UserInputHandler(std::map<int, Property*>* propertyMap, bool notifyWhileReplaying,
-            int playerDirectedMovementId, int locationInSpaceId);
-
-        /*
-        * Handles the specific player input in the given event.
-        * 
-        * e: event being handled
-        */
-        void onEvent(Event* e);
-};
-
+#pragma once
+#include "EventHandler.h"
+#include "ClientServerConsts.h"
+#include "PlayerDirectedMovement.h"
+#include "LocationInSpace.h"
+#include "EventManager.h"
+#include "Behavior.h"
+
+/*
+* Event handler that handles inputs from the user.
+*/
+class UserInputHandler :
+    public EventHandler
+{
+    private:
+        /* id of PlayerDirectedMovement property to use for performing character movements */
+        int playerDirectedMovementId;
+
+        /* id of LocationInSpace property to use in checking character positions*/
+        int locationInSpaceId;
+
+        /* PlayerDirectedMovement property (resolved from playerDirectedMovementId at construction) */
+        PlayerDirectedMovement* playerDirectedMovement;
+
+        /* LocationInSpace property (resolved from locationInSpaceId at construction) */
+        LocationInSpace* locationInSpace;
+
+        /* number of jumps started by each character (used to tell whether a jump behavior is still the current one) */
+        std::map<int, unsigned long long> jumpNums;
+
+        /* time waited between steps of a jump */
+        static constexpr float JUMP_STEP_DELAY = 100.f;
+
+        /*
+        * Returns whether the given jump is still being performed by the character.
+        * 
+        * characterId: id of character
+        * jumpNum: number of the jump
+        * 
+        * returns: true if the character still exists and is jumping up in the given jump, false otherwise
+        */
+        bool isCurrentJump(int characterId, unsigned long long jumpNum);
+
+        /*
+        * Carries out the rest of a jump that the character just started, one step at a time, until the character stops jumping.
+        * 
+        * characterId: id of character
+        * jumpNum: number of the jump
+        */
+        Behavior performJump(int characterId, unsigned long long jumpNum);
+
+    public:
+        /*
+        * Constructs a UserInputHandler with the given values.
+        * 
+        * propertyRegistry: registry of all properties
+        * notifyWhileReplaying: whether to notify this handler of events while a replay is being played
+        * playerDirectedMovementId: id of PlayerDirectedMovement property to use in performing character movements
+        * locationInSpaceId: id of LocationInSpace property to use in checking character positions
+        */
+        UserInputHandler(PropertyRegistry* propertyRegistry, bool notifyWhileReplaying,
+            int playerDirectedMovementId, int locationInSpaceId);
+
+        /*
+        * Handles the specific player input in the given event.
+        * 
+        * e: event being handled
+        */
+        void onEvent(Event* e);
+};
+
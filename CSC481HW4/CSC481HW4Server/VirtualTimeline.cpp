@@ -0,0 +1,26 @@
+#include "VirtualTimeline.h"
+
+VirtualTimeline::VirtualTimeline(float tic) : Timeline(tic, nullptr)
+{
+    virtualTime = 0.0;
+}
+
+float VirtualTimeline::computeTime()
+{
+    //calculate total elapsed time (subtracting out paused time)
+    float elapsedTime = (float)virtualTime;
+    elapsedTime -= getElapsedPauseTime();
+
+    //return total elapsed time divided by current tic size
+    return elapsedTime / getTic();
+}
+
+void VirtualTimeline::advance(float seconds)
+{
+    virtualTime += seconds;
+}
+
+double VirtualTimeline::getVirtualTime()
+{
+    return virtualTime;
+}
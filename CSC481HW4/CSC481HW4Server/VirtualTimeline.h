@@ -0,0 +1,44 @@
+#pragma once
+#include "Timeline.h"
+
+/*
+* A timeline measuring virtual time in seconds, which only passes when the timeline is told to advance. Used in place of a
+* RealTimeline to run the simulation headless as fast as it can go (or at any other pace) rather than in real time.
+*/
+class VirtualTimeline :
+	public Timeline
+{
+private:
+	/* total virtual time that has passed, in seconds */
+	double virtualTime;
+
+protected:
+	/*
+	* Function that returns the total time elapsed based on the timeline's measurement of virtual time in seconds
+	* and tic size (minus any time spent paused).
+	*
+	* returns: total elapsed time
+	*/
+	float computeTime();
+
+public:
+	/*
+	* Constructs the timeline with the given tic size and initially unpaused, starting at 0 virtual time.
+	*/
+	VirtualTimeline(float tic);
+
+	/*
+	* Advances virtual time by the given amount. If time is frozen for a tick, the change only shows in the next tick (so this is
+	* normally called between ticks).
+	*
+	* seconds: amount of virtual time to pass, in seconds
+	*/
+	void advance(float seconds);
+
+	/*
+	* Returns the total virtual time that has passed, regardless of tic size or pausing.
+	*
+	* returns: total virtual time in seconds
+	*/
+	double getVirtualTime();
+};
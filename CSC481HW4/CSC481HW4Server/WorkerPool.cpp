@@ -0,0 +1,115 @@
+#include "WorkerPool.h"
+
+WorkerPool::WorkerPool(int workersNum)
+{
+	tasksNum = 0;
+	nextTask = 0;
+	tasksRemaining = 0;
+	batchNumber = 0;
+	stopping = false;
+
+	for (int i = 0; i < workersNum; i++)
+	{
+		workers.push_back(std::thread(&WorkerPool::workerLoop, this));
+	}
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopping = true;
+	}
+	batchAvailable.notify_all();
+
+	int workersNum = workers.size();
+	for (int i = 0; i < workersNum; i++)
+	{
+		workers[i].join();
+	}
+}
+
+void WorkerPool::run(int tasksNum, std::function<void(int)> task)
+{
+	if (tasksNum <= 0)
+	{
+		return;
+	}
+
+	unsigned long long batch;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		this->task = task;
+		this->tasksNum = tasksNum;
+		nextTask = 0;
+		tasksRemaining = tasksNum;
+		batchNumber++;
+		batch = batchNumber;
+	}
+	batchAvailable.notify_all();
+
+	//help out rather than sitting idle
+	workOnBatch(batch);
+
+	//wait for tasks claimed by workers to finish
+	std::unique_lock<std::mutex> guard(lock);
+	batchFinished.wait(guard, [this]() { return tasksRemaining == 0; });
+}
+
+int WorkerPool::getWorkersNum()
+{
+	return workers.size();
+}
+
+void WorkerPool::workOnBatch(unsigned long long batch)
+{
+	while (true)
+	{
+		//claim a task, making sure the batch hasn't been replaced by a newer one in the meantime
+		int taskIndex;
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			if (batch != batchNumber || nextTask >= tasksNum)
+			{
+				return;
+			}
+			taskIndex = nextTask;
+			nextTask++;
+		}
+
+		task(taskIndex);
+
+		bool lastTask = false;
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			tasksRemaining--;
+			lastTask = tasksRemaining == 0;
+		}
+		if (lastTask)
+		{
+			batchFinished.notify_all();
+		}
+	}
+}
+
+void WorkerPool::workerLoop()
+{
+	unsigned long long lastBatch = 0;
+
+	while (true)
+	{
+		unsigned long long batch;
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			batchAvailable.wait(guard, [this, lastBatch]() { return stopping || batchNumber != lastBatch; });
+			if (stopping)
+			{
+				return;
+			}
+			batch = batchNumber;
+		}
+
+		workOnBatch(batch);
+		lastBatch = batch;
+	}
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+/*
+* A fixed set of worker threads that run batches of independent tasks. The thread submitting a batch also works on it, and
+* run only returns once every task in the batch has finished.
+*/
+class WorkerPool
+{
+	private:
+		/* worker threads */
+		std::vector<std::thread> workers;
+
+		/* lock protecting the current batch */
+		std::mutex lock;
+
+		/* signalled when a new batch is submitted (or the pool is stopping) */
+		std::condition_variable batchAvailable;
+
+		/* signalled when the last task of a batch finishes */
+		std::condition_variable batchFinished;
+
+		/* function run for each task of the current batch (given the task's index) */
+		std::function<void(int)> task;
+
+		/* number of tasks in the current batch */
+		int tasksNum;
+
+		/* index of the next task to be claimed */
+		int nextTask;
+
+		/* number of tasks not yet finished */
+		int tasksRemaining;
+
+		/* number of the current batch (lets workers tell a new batch from one they've already worked on) */
+		unsigned long long batchNumber;
+
+		/* whether the pool is shutting down */
+		bool stopping;
+
+		/*
+		* Claims and runs tasks from the given batch until none are left to claim.
+		*
+		* batch: number of batch to work on
+		*/
+		void workOnBatch(unsigned long long batch);
+
+		/*
+		* Loop run by each worker thread.
+		*/
+		void workerLoop();
+
+	public:
+		/*
+		* Constructs a pool with the given number of worker threads (in addition to the thread that submits batches).
+		*
+		* workersNum: number of worker threads to start
+		*/
+		WorkerPool(int workersNum);
+
+		/*
+		* Stops and joins all worker threads.
+		*/
+		~WorkerPool();
+
+		/*
+		* Runs the given function once for each task index in [0, tasksNum) across the pool and waits for all of them to finish.
+		*
+		* tasksNum: number of tasks
+		* task: function to run for each task index
+		*/
+		void run(int tasksNum, std::function<void(int)> task);
+
+		/*
+		* Returns the number of worker threads.
+		*
+		* returns: number of worker threads (not counting the thread submitting batches)
+		*/
+		int getWorkersNum();
+};
@@ -1,828 +1,1013 @@
-#include <zmq.hpp>
-#include <stdlib.h>
-#include <string>
-#include <stdio.h>
-#include <iostream>
-#include <SFML/Graphics.hpp>
-#include <iostream>
-#include "Timeline.h"
-#include <thread>
-#include <chrono>
-#include "ClientServerConsts.h"
-#include "Property.h"
-#include "LocationInSpace.h"
-#include "Collision.h"
-
-#ifndef _WIN32
-#include <unistd.h>
-#else
-#include <windows.h>
-
-#define sleep(n)    Sleep(n)
-#endif
-#include "RepeatedMovement.h"
-#include "RealTimeline.h"
-#include "GameTimeline.h"
-#include "ServerClientPositionCommunication.h"
-#include <mutex>
-#include "Event.h"
-#include "EventHandler.h"
-#include "EventManager.h"
-#include "PositionalUpdateHandler.h"
-#include "PlayerDirectedMovement.h"
-#include "UserInputHandler.h"
-#include "Gravity.h"
-#include "GravityHandler.h"
-#include "Respawning.h"
-#include "CharacterCollisionHandler.h"
-#include "CharacterDeathHandler.h"
-#include "CharacterSpawnHandler.h"
-#include "PlatformMovingCharacterHandler.h"
-#include "ReplayHandler.h"
-
-/* context for all sockets */
-zmq::context_t* context;
-
-/* socket used for receiving connection/disconnection requests from clients */
-zmq::socket_t* connectDisconnectReqRepSocket;
-
-/* socket used for sending connection/disconnection updates to all clients */
-zmq::socket_t* connectDisconnectPubSubSocket;
-
-/* socket used for sending movement updates to all clients */
-zmq::socket_t* movementUpdatePubSubSocket;
-
-/* socket used for sending object creation messages to connecting client */
-zmq::socket_t* objectCreationReqRepSocket;
-
-/* counter providing next GUID to be assigned */
-int idCounter;
-
-/* map with all properties */
-std::map<int, Property*> propertyMap;
-
-/*character properties*/
-LocationInSpace* characterLocationsInSpace;
-Collision* characterCollisions;
-ServerClientPositionCommunication* characterServerClientPositionCommunications;
-PlayerDirectedMovement* characterPlayerDirectedMovements;
-Gravity* characterGravity;
-Respawning* characterRespawning;
-
-/*platform properties*/
-LocationInSpace* firstScreenStaticPlatformLocationsInSpace;
-LocationInSpace* firstScreenMovingPlatformLocationsInSpace;
-Collision* firstScreenStaticPlatformCollisions;
-Collision* firstScreenMovingPlatformCollisions;
-
-/* spawn point properties */
-LocationInSpace* spawnPointLocationsInSpace;
-
-/* death zone properties */
-LocationInSpace* deathZoneLocationsInSpace;
-Collision* deathZoneCollisions;
-
-/*ids of rendering properties for clients*/
-int firstScreenStaticPlatformRendering;
-int firstScreenMovingPlatformRendering;
-int characterRendering;
-
-/* manager for events */
-EventManager* eventManager;
-
-/* modifier for individual client event port numbers */
-int eventPortModifier;
-
-/* mutex controlling access to event queue */
-std::mutex queueLock;
-
-/* id of starting platform */
-int platform1Id;
-
-/* id of starting spawn point */
-int spawnPoint1Id;
-
-/*
-* Returns the next id for assignment and then updates the counter.
-* 
-* returns: id to use for next assignment
-*/
-int getNextId()
-{
-	int nextId = idCounter;
-	idCounter++;
-	return nextId;
-}
-
-/*
-* Preps a message to be sent to the client for creating a particular property or object.
-* 
-* objectOrPropertyType: type of property or object being created
-* objectOrPropertyId: id of property or object being created
-* locationInSpacePropertyId: if object, id of corresponding locationInSpace property (filler if property)
-* renderingPropertyId: if object, id of corresponding rendering property (filler if property)
-* color: if object, color to give it (filler if property)
-* x: if object, x position (filler of property)
-* y: if object, y position (filler if property)
-* 
-* returns: pointer to message to send to client
-*/
-zmq::message_t* prepCreationMessage(int objectOrPropertyType, int objectOrPropertyId, int locationInSpacePropertyId,
-	int renderingPropertyId, int color, float x, float y)
-{
-	std::string replyString = std::to_string(objectOrPropertyType) + " " + std::to_string(objectOrPropertyId) + " "
-		+ std::to_string(locationInSpacePropertyId) + " " + std::to_string(renderingPropertyId) + " " +
-		std::to_string(color) + " " + std::to_string(x) + " " + std::to_string(y);
-	zmq::message_t* msg = new zmq::message_t(replyString.length() + 1);
-	const char* replyChars = replyString.c_str();
-	memcpy(msg->data(), replyChars, replyString.length() + 1);
-
-	return msg;
-}
-
-/*
-* Should be run in a separate thread for each client to allow checking for client event requests in parallel.
-*
-* eventPortNum: port number to use in creating socket
-*/
-void handleClientEventRequests(int eventPortNum)
-{
-	//std::cout << "Client thread starting" << std::endl;
-
-	//prepare and bind socket
-	zmq::socket_t eventRaisingReqRepSocket(*context, ZMQ_REP);
-	//std::cout << "Created thread socket" << std::endl;
-	
-	eventRaisingReqRepSocket.bind(ClientServerConsts::EVENT_RAISING_REQ_REP_SERVER_PORT_START + std::to_string(eventPortNum));
-	//std::cout << "Bound thread socket" << std::endl;
-
-	bool clientStillConnected = true;
-
-	while (clientStillConnected)
-	{
-		//sleep for a bit
-		sleep(5);
-
-		//see if there's a request from client, and if so handle it
-		try
-		{
-			std::lock_guard<std::mutex> lock(queueLock);
-			zmq::message_t clientRequest;
-
-			if (eventRaisingReqRepSocket.recv(clientRequest, zmq::recv_flags::dontwait))
-			{
-				//determine event type
-				int eventType = -1;
-				int scan = sscanf_s(clientRequest.to_string().c_str(), "%d", &eventType);
-
-				if (eventType == ClientServerConsts::USER_INPUT_EVENT_CODE)
-				{
-					//retrieve arguments
-					int characterId = -1;
-					int keyType = -1;
-
-					int nextScan = sscanf_s(clientRequest.to_string().c_str(), "%d %d %d", &eventType, &characterId, &keyType);
-
-					//if we are playing replay, only raise user input event if it is one of the three speed change keys
-					if (!EventManager::getManager()->isPlayingReplay()
-						|| (EventManager::getManager()->isPlayingReplay() && (keyType == ClientServerConsts::ONE_KEY ||
-							keyType == ClientServerConsts::TWO_KEY || keyType == ClientServerConsts::THREE_KEY)))
-					{
-						//create and raise event
-						struct Event::ArgumentVariant characterIdArg = { Event::ArgumentType::TYPE_INTEGER, characterId };
-						struct Event::ArgumentVariant keyTypeArg = { Event::ArgumentType::TYPE_INTEGER, keyType };
-						float eventTime = 0.f;
-						//if we are playing replay, make sure to set time so that event will be taken care of right away
-						if (EventManager::getManager()->isPlayingReplay())
-						{
-							eventTime = 0.f;
-						}
-						else
-						{
-							eventTime = EventManager::getManager()->getCurrentTime();
-						}
-
-						Event* userInputEvent = new Event(eventTime,
-							ClientServerConsts::USER_INPUT_EVENT,
-							{ characterIdArg, keyTypeArg });
-						EventManager::getManager()->raise(userInputEvent);
-					}
-				}
-				else if (eventType == ClientServerConsts::CLIENT_DISCONNECT_EVENT_CODE)
-				{
-					clientStillConnected = false;
-				}
-
-				//send back response
-				std::string replyString = "Event Received";
-				zmq::message_t* msg = new zmq::message_t(replyString.length() + 1);
-				const char* replyChars = replyString.c_str();
-				memcpy(msg->data(), replyChars, replyString.length() + 1);
-				eventRaisingReqRepSocket.send(*msg, zmq::send_flags::none);
-			}
-		}
-		catch (...)
-		{
-			std::cerr << "Error while checking for/handling client event request" << std::endl;
-		}
-	}
-
-	//std::cout << "Client thread ending" << std::endl;
-}
-
-/*
-* Checks for any connection/disconnection requests and processes them. Returns true if a connection was established to allow
-* adding a new thread to handle it.
-*/
-bool checkForConnectionUpdate()
-{
-	zmq::message_t connectDisconnectRequest;
-	if (connectDisconnectReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::dontwait))
-	{
-		//parse out request
-		int connectionObjectId = 0;
-		int scan = sscanf_s(connectDisconnectRequest.to_string().c_str(), "%d", &connectionObjectId);
-		//std::cout << "Received from client: " + std::to_string(connectionObjectId) << std::endl;
-
-		//if incorrect request, print error and send back error message
-		if (scan != 1)
-		{
-			std::cerr << "Error in communication while processing connection request" << std::endl;
-			std::string replyString = std::to_string(ClientServerConsts::CONNECT_ERROR_CODE) + " " + std::to_string(-1);
-			zmq::message_t replyMsg(replyString.length() + 1);
-			const char* replyChars = replyString.c_str();
-			memcpy(replyMsg.data(), replyChars, replyString.length() + 1);
-			connectDisconnectReqRepSocket->send(replyMsg, zmq::send_flags::none);
-			return false;
-		}
-		//if client is connecting, add character for them, send back message with character id
-		//and event port number, and publish connection update to all clients
-		else if (connectionObjectId == ClientServerConsts::CONNECT_CODE)
-		{
-			//create character shape
-			sf::CircleShape* characterShape = new sf::CircleShape(ClientServerConsts::CHARACTER_RADIUS, ClientServerConsts::CHARACTER_NUM_OF_POINTS);
-			characterShape->setFillColor(sf::Color::Red);
-			characterShape->setPosition(sf::Vector2f(50.f, 0.f));
-			int charId = getNextId();
-
-			//add character to properties
-			characterLocationsInSpace->addObject(charId, characterShape);
-			characterCollisions->addObject(charId, characterLocationsInSpace->getId());
-			characterServerClientPositionCommunications->addObject(charId, characterLocationsInSpace->getId());
-			characterPlayerDirectedMovements->addObject(charId, characterLocationsInSpace->getId(), characterCollisions->getId(),
-				{ PlayerDirectedMovement::MovementOnInput(-1.f, 0.f, sf::Keyboard::Left, false),
-				PlayerDirectedMovement::MovementOnInput(1.f, 0.f, sf::Keyboard::Right, false),
-				PlayerDirectedMovement::MovementOnInput(0.f, -100.f, sf::Keyboard::Up, true) },
-				ClientServerConsts::CHARACTER_VELOCITY, true, { firstScreenStaticPlatformCollisions->getId(),
-				firstScreenMovingPlatformCollisions->getId() });
-			characterGravity->addObject(charId, characterLocationsInSpace->getId(), characterCollisions->getId(),
-				{ firstScreenStaticPlatformCollisions->getId(),
-				firstScreenMovingPlatformCollisions->getId() },
-				platform1Id, ClientServerConsts::CHARACTER_VELOCITY);
-			characterRespawning->addObject(charId, characterLocationsInSpace->getId(),
-				Respawning::SpawnPoint(spawnPoint1Id, spawnPointLocationsInSpace->getId()));
-
-			//send message with character id and event port number
-			int newEventPortNum = ClientServerConsts::EVENT_RAISING_REQ_REP_NUM_START + eventPortModifier;
-			std::string replyString = std::to_string(charId) + " " + std::to_string(newEventPortNum);
-			zmq::message_t replyMsg(replyString.length() + 1);
-			const char* replyChars = replyString.c_str();
-			memcpy(replyMsg.data(), replyChars, replyString.length() + 1);
-			connectDisconnectReqRepSocket->send(replyMsg, zmq::send_flags::none);
-
-			//send messages to client to create location in space properties
-			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
-			zmq::message_t* firstScreenStaticPlatformMsg = prepCreationMessage(ClientServerConsts::PROPERTY_LOCATION_IN_SPACE,
-				firstScreenStaticPlatformLocationsInSpace->getId(), ClientServerConsts::CREATION_FILLER, 
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
-			objectCreationReqRepSocket->send(*firstScreenStaticPlatformMsg, zmq::send_flags::none);
-			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
-			zmq::message_t* firstScreenMovingPlatformMsg = prepCreationMessage(ClientServerConsts::PROPERTY_LOCATION_IN_SPACE,
-				firstScreenMovingPlatformLocationsInSpace->getId(), ClientServerConsts::CREATION_FILLER,
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
-			objectCreationReqRepSocket->send(*firstScreenMovingPlatformMsg, zmq::send_flags::none);
-			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
-			zmq::message_t* existingCharsMsg = prepCreationMessage(ClientServerConsts::PROPERTY_LOCATION_IN_SPACE,
-				characterLocationsInSpace->getId(), ClientServerConsts::CREATION_FILLER,
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
-			objectCreationReqRepSocket->send(*existingCharsMsg, zmq::send_flags::none);
-
-			//send messages to client to create rendering properties
-			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
-			zmq::message_t* firstScreenStaticPlatformRenderingMsg = prepCreationMessage(ClientServerConsts::PROPERTY_RENDERING,
-				firstScreenStaticPlatformRendering, ClientServerConsts::CREATION_FILLER,
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
-			objectCreationReqRepSocket->send(*firstScreenStaticPlatformRenderingMsg, zmq::send_flags::none);
-			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
-			zmq::message_t* firstScreenMovingPlatformRenderingMsg = prepCreationMessage(ClientServerConsts::PROPERTY_RENDERING,
-				firstScreenMovingPlatformRendering, ClientServerConsts::CREATION_FILLER,
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
-			objectCreationReqRepSocket->send(*firstScreenMovingPlatformRenderingMsg, zmq::send_flags::none);
-			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
-			zmq::message_t* existingCharsRenderingMsg = prepCreationMessage(ClientServerConsts::PROPERTY_RENDERING,
-				characterRendering, ClientServerConsts::CREATION_FILLER,
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
-			objectCreationReqRepSocket->send(*existingCharsRenderingMsg, zmq::send_flags::none);
-
-			//send messages to client to create first screen static platforms
-			std::vector<int> firstScreenStaticPlatforms = firstScreenStaticPlatformLocationsInSpace->getObjects();
-			int firstScreenStaticPlatformsNum = firstScreenStaticPlatforms.size();
-			for (int i = 0; i < firstScreenStaticPlatformsNum; i++)
-			{
-				objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
-				sf::Shape* staticPlatformShape = firstScreenStaticPlatformLocationsInSpace->getObjectShape(firstScreenStaticPlatforms[i]);
-				zmq::message_t* staticPlatformCreationMsg = prepCreationMessage(ClientServerConsts::STATIC_PLATFORM,
-					firstScreenStaticPlatforms[i], firstScreenStaticPlatformLocationsInSpace->getId(),
-					firstScreenStaticPlatformRendering, staticPlatformShape->getFillColor().toInteger(),
-					staticPlatformShape->getPosition().x, staticPlatformShape->getPosition().y);
-				objectCreationReqRepSocket->send(*staticPlatformCreationMsg, zmq::send_flags::none);
-			}
-
-			//send messages to client to create first screen moving platforms
-			std::vector<int> firstScreenMovingPlatforms = firstScreenMovingPlatformLocationsInSpace->getObjects();
-			int firstScreenMovingPlatformsNum = firstScreenMovingPlatforms.size();
-			for (int i = 0; i < firstScreenMovingPlatformsNum; i++)
-			{
-				objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
-				sf::Shape* movingPlatformShape = firstScreenMovingPlatformLocationsInSpace->getObjectShape(firstScreenMovingPlatforms[i]);
-				zmq::message_t* movingPlatformCreationMsg = prepCreationMessage(ClientServerConsts::MOVING_PLATFORM,
-					firstScreenMovingPlatforms[i], firstScreenMovingPlatformLocationsInSpace->getId(),
-					firstScreenMovingPlatformRendering, movingPlatformShape->getFillColor().toInteger(),
-					movingPlatformShape->getPosition().x, movingPlatformShape->getPosition().y);
-				objectCreationReqRepSocket->send(*movingPlatformCreationMsg, zmq::send_flags::none);
-			}
-
-			//send messages to client to create existing characters
-			std::vector<int> existingChars = characterLocationsInSpace->getObjects();
-			int existingCharsNum = existingChars.size();
-			for (int i = 0; i < existingCharsNum; i++)
-			{
-				objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
-				sf::Shape* charShape = characterLocationsInSpace->getObjectShape(existingChars[i]);
-				zmq::message_t* charCreationMsg = prepCreationMessage(ClientServerConsts::CHARACTER,
-					existingChars[i], characterLocationsInSpace->getId(),
-					characterRendering, charShape->getFillColor().toInteger(),
-					charShape->getPosition().x, charShape->getPosition().y);
-				objectCreationReqRepSocket->send(*charCreationMsg, zmq::send_flags::none);
-			}
-
-			//send message to client indicating end of object/property creation
-			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
-			 zmq::message_t* endCreationMsg = prepCreationMessage(ClientServerConsts::CREATION_END, ClientServerConsts::CREATION_FILLER,
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
-				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
-			objectCreationReqRepSocket->send(*endCreationMsg, zmq::send_flags::none);
-
-			//publish connection message to all clients so they can add new character
-			std::string connectMsgString = std::to_string(ClientServerConsts::CONNECT_CODE) + " " + std::to_string(charId) + " " 
-				+ std::to_string(characterLocationsInSpace->getId()) + " " + std::to_string(characterRendering)
-				+ " " + std::to_string(characterShape->getPosition().x) + " " + std::to_string(characterShape->getPosition().y);
-			zmq::message_t connectMsg(connectMsgString.length() + 1);
-			const char* connectChars = connectMsgString.c_str();
-			memcpy(connectMsg.data(), connectChars, connectMsgString.length() + 1);
-			connectDisconnectPubSubSocket->send(connectMsg, zmq::send_flags::none);
-
-			return true;
-		}
-		//if client is disconnecting, remove character from all properties in which it exists, inform thread to stop running,
-		//send back message with success code, and publish disconnection update to all clients
-		else
-		{
-			characterLocationsInSpace->removeObject(connectionObjectId);
-			characterCollisions->removeObject(connectionObjectId);
-			characterServerClientPositionCommunications->removeObject(connectionObjectId);
-			characterPlayerDirectedMovements->removeObject(connectionObjectId);
-			characterGravity->removeObject(connectionObjectId);
-			characterRespawning->removeObject(connectionObjectId);
-
-			//send message with disconnect success code
-			std::string replyString = std::to_string(ClientServerConsts::DISCONNECT_SUCCESS_CODE);
-			zmq::message_t replyMsg(replyString.length() + 1);
-			const char* replyChars = replyString.c_str();
-			memcpy(replyMsg.data(), replyChars, replyString.length() + 1);
-			connectDisconnectReqRepSocket->send(replyMsg, zmq::send_flags::none);
-
-			//publish disconnection update to all clients
-			std::string updateString = std::to_string(ClientServerConsts::DISCONNECT_CODE) + " " + std::to_string(connectionObjectId)
-				+ " " + std::to_string(characterLocationsInSpace->getId()) + " " + std::to_string(characterRendering)
-				+ " " + std::to_string(ClientServerConsts::CONNECTION_FILLER) + " " 
-				+ std::to_string(ClientServerConsts::CONNECTION_FILLER);
-			zmq::message_t updateMsg(updateString.length() + 1);
-			const char* updateChars = updateString.c_str();
-			memcpy(updateMsg.data(), updateChars, updateString.length() + 1);
-			connectDisconnectPubSubSocket->send(updateMsg, zmq::send_flags::none);
-
-			return false;
-		}
-	}
-
-	return false;
-}
-
-int main()
-{
-
-	/*TODO: PREPARE STATE*/
-	//initialize GUID counter and port modifier
-	idCounter = 0;
-	eventPortModifier = 0;
-
-	// Prepare our context and sockets
-	context = new zmq::context_t(1);
-	connectDisconnectReqRepSocket = new zmq::socket_t(*context, ZMQ_REP);
-	connectDisconnectPubSubSocket = new zmq::socket_t(*context, ZMQ_PUB);
-	movementUpdatePubSubSocket = new zmq::socket_t(*context, ZMQ_PUB);
-	objectCreationReqRepSocket = new zmq::socket_t(*context, ZMQ_REP);
-
-	//bind sockets
-	connectDisconnectReqRepSocket->bind(ClientServerConsts::CONNECT_DISCONNECT_REQ_REP_SERVER_PORT);
-	connectDisconnectPubSubSocket->bind(ClientServerConsts::CONNECT_DISCONNECT_PUB_SUB_SERVER_PORT);
-	connectDisconnectPubSubSocket->set(zmq::sockopt::sndhwm, 10);
-	movementUpdatePubSubSocket->bind(ClientServerConsts::MOVEMENT_UPDATE_PUB_SUB_SERVER_PORT);
-	movementUpdatePubSubSocket->set(zmq::sockopt::sndhwm, 10);
-	objectCreationReqRepSocket->bind(ClientServerConsts::OBJECT_CREATION_REQ_REP_SERVER_PORT);
-
-	/* create static platform shapes for first "screen"*/
-	//starting platform
-	sf::RectangleShape* platform1Shape = new sf::RectangleShape(sf::Vector2f(ClientServerConsts::PLATFORM_WIDTH,
-		ClientServerConsts::PLATFORM_HEIGHT));
-	platform1Shape->setFillColor(sf::Color::Green);
-	platform1Shape->setPosition(sf::Vector2f(50.f, 100.f));
-	platform1Id = getNextId();
-	//platform to right of starting one
-	sf::RectangleShape* platform2Shape = new sf::RectangleShape(sf::Vector2f(ClientServerConsts::PLATFORM_WIDTH,
-		ClientServerConsts::PLATFORM_HEIGHT));
-	platform2Shape->setFillColor(sf::Color::Black);
-	platform2Shape->setPosition(sf::Vector2f(platform1Shape->getPosition().x + ClientServerConsts::PLATFORM_WIDTH + 50.f,
-		platform1Shape->getPosition().y));
-	int platform2Id = getNextId();
-	//platform left of first "elevator"
-	sf::RectangleShape* platform3Shape = new sf::RectangleShape(sf::Vector2f(ClientServerConsts::PLATFORM_WIDTH,
-		ClientServerConsts::PLATFORM_HEIGHT));
-	platform3Shape->setFillColor(sf::Color::Yellow);
-	platform3Shape->setPosition(sf::Vector2f(platform2Shape->getPosition().x + 50.f, platform2Shape->getPosition().y + 200.f));
-	int platform3Id = getNextId();
-	//platform at end of multidirectional platform route
-	sf::RectangleShape* platform4Shape = new sf::RectangleShape(sf::Vector2f(ClientServerConsts::PLATFORM_WIDTH,
-		ClientServerConsts::PLATFORM_HEIGHT));
-	platform4Shape->setFillColor(sf::Color::Green);
-	platform4Shape->setPosition(sf::Vector2f(platform1Shape->getPosition().x + 100.f, platform1Shape->getPosition().y + 400.f));
-	int platform4Id = getNextId();
-	//platform to left of transitional platform
-	sf::RectangleShape* platform5Shape = new sf::RectangleShape(sf::Vector2f(ClientServerConsts::PLATFORM_WIDTH,
-		ClientServerConsts::PLATFORM_HEIGHT));
-	platform5Shape->setFillColor(sf::Color::Black);
-	platform5Shape->setPosition(sf::Vector2f(platform4Shape->getPosition().x + ClientServerConsts::PLATFORM_WIDTH + 200.f,
-		platform4Shape->getPosition().y));
-	int platform5Id = getNextId();
-
-	//create static platforms for first "screen" by defining their properties (LocationInSpace and Collision; no Rendering on server)
-	firstScreenStaticPlatformLocationsInSpace = new LocationInSpace(getNextId(), &propertyMap);
-	propertyMap.insert(std::pair<int, Property*>(firstScreenStaticPlatformLocationsInSpace->getId(), 
-		firstScreenStaticPlatformLocationsInSpace));
-	firstScreenStaticPlatformLocationsInSpace->addObject(platform1Id, platform1Shape);
-	firstScreenStaticPlatformLocationsInSpace->addObject(platform2Id, platform2Shape);
-	firstScreenStaticPlatformLocationsInSpace->addObject(platform3Id, platform3Shape);
-	firstScreenStaticPlatformLocationsInSpace->addObject(platform4Id, platform4Shape);
-	firstScreenStaticPlatformLocationsInSpace->addObject(platform5Id, platform5Shape);
-	firstScreenStaticPlatformCollisions = new Collision(getNextId(), &propertyMap);
-	propertyMap.insert(std::pair<int, Property*>(firstScreenStaticPlatformCollisions->getId(), firstScreenStaticPlatformCollisions));
-	firstScreenStaticPlatformCollisions->addObject(platform1Id, firstScreenStaticPlatformLocationsInSpace->getId());
-	firstScreenStaticPlatformCollisions->addObject(platform2Id, firstScreenStaticPlatformLocationsInSpace->getId());
-	firstScreenStaticPlatformCollisions->addObject(platform3Id, firstScreenStaticPlatformLocationsInSpace->getId());
-	firstScreenStaticPlatformCollisions->addObject(platform4Id, firstScreenStaticPlatformLocationsInSpace->getId());
-	firstScreenStaticPlatformCollisions->addObject(platform5Id, firstScreenStaticPlatformLocationsInSpace->getId());
-	//only need id of rendering to send to client
-	firstScreenStaticPlatformRendering = getNextId();
-
-	/*create moving platform shapes for first "screen"*/
-	//first "elevator" platform
-	sf::RectangleShape* movingPlatform1Shape = new sf::RectangleShape(sf::Vector2f(ClientServerConsts::PLATFORM_WIDTH,
-		ClientServerConsts::PLATFORM_HEIGHT));
-	movingPlatform1Shape->setFillColor(sf::Color::White);
-	movingPlatform1Shape->setPosition(sf::Vector2f(platform2Shape->getPosition().x + ClientServerConsts::PLATFORM_WIDTH + 100.f,
-		platform2Shape->getPosition().y));
-	int movingPlatform1Id = getNextId();
-	//multidirectional platform
-	sf::RectangleShape* movingPlatform2Shape = new sf::RectangleShape(sf::Vector2f(ClientServerConsts::PLATFORM_WIDTH,
-		ClientServerConsts::PLATFORM_HEIGHT));
-	movingPlatform2Shape->setFillColor(sf::Color::White);
-	movingPlatform2Shape->setPosition(sf::Vector2f(platform3Shape->getPosition().x - ClientServerConsts::PLATFORM_WIDTH - 50.f,
-		platform3Shape->getPosition().y));
-	int movingPlatform2Id = getNextId();
-	//second "elevator" platform
-	sf::RectangleShape* movingPlatform3Shape = new sf::RectangleShape(sf::Vector2f(ClientServerConsts::PLATFORM_WIDTH,
-		ClientServerConsts::PLATFORM_HEIGHT));
-	movingPlatform3Shape->setFillColor(sf::Color::White);
-	movingPlatform3Shape->setPosition(sf::Vector2f(platform4Shape->getPosition().x + ClientServerConsts::PLATFORM_WIDTH + 50.f,
-		platform4Shape->getPosition().y));
-	int movingPlatform3Id = getNextId();
-	//diagonally moving platform
-	sf::RectangleShape* movingPlatform4Shape = new sf::RectangleShape(sf::Vector2f(ClientServerConsts::PLATFORM_WIDTH,
-		ClientServerConsts::PLATFORM_HEIGHT));
-	movingPlatform4Shape->setFillColor(sf::Color::White);
-	movingPlatform4Shape->setPosition(sf::Vector2f(platform5Shape->getPosition().x + 100.f,
-		platform5Shape->getPosition().y + -ClientServerConsts::PLATFORM_HEIGHT - 60.f));
-	int movingPlatform4Id = getNextId();
-	//transitional platform
-	sf::RectangleShape* movingPlatform5Shape = new sf::RectangleShape(sf::Vector2f(ClientServerConsts::PLATFORM_WIDTH,
-		ClientServerConsts::PLATFORM_HEIGHT));
-	movingPlatform5Shape->setFillColor(sf::Color::White);
-	movingPlatform5Shape->setPosition(sf::Vector2f(platform5Shape->getPosition().x + ClientServerConsts::PLATFORM_WIDTH + 100.f,
-		platform5Shape->getPosition().y));
-	int movingPlatform5Id = getNextId();
-
-	/*create moving platforms for first "screen" by defining their properties (LocationInSpace, Collision, RepeatedMovement,
-	* ServerClientPositionCommunication; no Rendering on server)
-	*/
-	firstScreenMovingPlatformLocationsInSpace = new LocationInSpace(getNextId(), &propertyMap);
-	propertyMap.insert(std::pair<int, Property*>(firstScreenMovingPlatformLocationsInSpace->getId(), 
-		firstScreenMovingPlatformLocationsInSpace));
-	firstScreenMovingPlatformLocationsInSpace->addObject(movingPlatform1Id, movingPlatform1Shape);
-	firstScreenMovingPlatformLocationsInSpace->addObject(movingPlatform2Id, movingPlatform2Shape);
-	firstScreenMovingPlatformLocationsInSpace->addObject(movingPlatform3Id, movingPlatform3Shape);
-	firstScreenMovingPlatformLocationsInSpace->addObject(movingPlatform4Id, movingPlatform4Shape);
-	firstScreenMovingPlatformLocationsInSpace->addObject(movingPlatform5Id, movingPlatform5Shape);
-	firstScreenMovingPlatformCollisions = new Collision(getNextId(), &propertyMap);
-	propertyMap.insert(std::pair<int, Property*>(firstScreenMovingPlatformCollisions->getId(), firstScreenMovingPlatformCollisions));
-	firstScreenMovingPlatformCollisions->addObject(movingPlatform1Id, firstScreenMovingPlatformLocationsInSpace->getId());
-	firstScreenMovingPlatformCollisions->addObject(movingPlatform2Id, firstScreenMovingPlatformLocationsInSpace->getId());
-	firstScreenMovingPlatformCollisions->addObject(movingPlatform3Id, firstScreenMovingPlatformLocationsInSpace->getId());
-	firstScreenMovingPlatformCollisions->addObject(movingPlatform4Id, firstScreenMovingPlatformLocationsInSpace->getId());
-	firstScreenMovingPlatformCollisions->addObject(movingPlatform5Id, firstScreenMovingPlatformLocationsInSpace->getId());
-	//only need id of rendering to send to client
-	firstScreenMovingPlatformRendering = getNextId();
-	RealTimeline* msTimeline = new RealTimeline(0.001f);
-	GameTimeline* movingPlatformTimeline = new GameTimeline(1.f, msTimeline);
-	RepeatedMovement* firstScreenMovingPlatformRepeatedMovements = new RepeatedMovement(getNextId(), &propertyMap, movingPlatformTimeline);
-	propertyMap.insert(std::pair<int, Property*>(firstScreenMovingPlatformRepeatedMovements->getId(), 
-		firstScreenMovingPlatformRepeatedMovements));
-	firstScreenMovingPlatformRepeatedMovements->addObject(movingPlatform1Id, firstScreenMovingPlatformLocationsInSpace->getId(),
-		{ RepeatedMovement::RepeatedMovementPosition(movingPlatform1Shape->getPosition().x, movingPlatform1Shape->getPosition().y, true),
-		RepeatedMovement::RepeatedMovementPosition(movingPlatform1Shape->getPosition().x, movingPlatform1Shape->getPosition().y + 100.f, true) },
-		ClientServerConsts::PLATFORM_PAUSE_DURATION, ClientServerConsts::PLATFORM_VELOCITY);
-	firstScreenMovingPlatformRepeatedMovements->addObject(movingPlatform2Id, firstScreenMovingPlatformLocationsInSpace->getId(),
-		{ RepeatedMovement::RepeatedMovementPosition(movingPlatform2Shape->getPosition().x, movingPlatform2Shape->getPosition().y, true),
-		RepeatedMovement::RepeatedMovementPosition(movingPlatform2Shape->getPosition().x - 100.f, movingPlatform2Shape->getPosition().y, false),
-		RepeatedMovement::RepeatedMovementPosition(movingPlatform2Shape->getPosition().x - 100.f, movingPlatform2Shape->getPosition().y + 100.f, true) },
-		ClientServerConsts::PLATFORM_PAUSE_DURATION, ClientServerConsts::PLATFORM_VELOCITY);
-	firstScreenMovingPlatformRepeatedMovements->addObject(movingPlatform3Id, firstScreenMovingPlatformLocationsInSpace->getId(),
-		{ RepeatedMovement::RepeatedMovementPosition(movingPlatform3Shape->getPosition().x, movingPlatform3Shape->getPosition().y, true),
-		RepeatedMovement::RepeatedMovementPosition(movingPlatform3Shape->getPosition().x, movingPlatform3Shape->getPosition().y - 50.f, true) },
-		ClientServerConsts::PLATFORM_PAUSE_DURATION, ClientServerConsts::PLATFORM_VELOCITY);
-	firstScreenMovingPlatformRepeatedMovements->addObject(movingPlatform4Id, firstScreenMovingPlatformLocationsInSpace->getId(),
-		{ RepeatedMovement::RepeatedMovementPosition(movingPlatform4Shape->getPosition().x, movingPlatform4Shape->getPosition().y, false),
-		RepeatedMovement::RepeatedMovementPosition(movingPlatform4Shape->getPosition().x + 50.f, movingPlatform4Shape->getPosition().y - 50.f, true) },
-		ClientServerConsts::PLATFORM_PAUSE_DURATION, ClientServerConsts::PLATFORM_VELOCITY);
-	firstScreenMovingPlatformRepeatedMovements->addObject(movingPlatform5Id, firstScreenMovingPlatformLocationsInSpace->getId(),
-		{ RepeatedMovement::RepeatedMovementPosition(movingPlatform5Shape->getPosition().x, movingPlatform5Shape->getPosition().y, true),
-		RepeatedMovement::RepeatedMovementPosition(movingPlatform5Shape->getPosition().x + 200.f, movingPlatform5Shape->getPosition().y, true) },
-		ClientServerConsts::PLATFORM_PAUSE_DURATION, ClientServerConsts::PLATFORM_VELOCITY);
-	ServerClientPositionCommunication* firstScreenMovingPlatformServerClientPositionCommunications =
-		new ServerClientPositionCommunication(getNextId(), &propertyMap);
-	propertyMap.insert(std::pair<int, Property*>(firstScreenMovingPlatformServerClientPositionCommunications->getId(), 
-		firstScreenMovingPlatformServerClientPositionCommunications));
-	firstScreenMovingPlatformServerClientPositionCommunications->addObject(movingPlatform1Id,
-		firstScreenMovingPlatformLocationsInSpace->getId());
-	firstScreenMovingPlatformServerClientPositionCommunications->addObject(movingPlatform2Id,
-		firstScreenMovingPlatformLocationsInSpace->getId());
-	firstScreenMovingPlatformServerClientPositionCommunications->addObject(movingPlatform3Id,
-		firstScreenMovingPlatformLocationsInSpace->getId());
-	firstScreenMovingPlatformServerClientPositionCommunications->addObject(movingPlatform4Id,
-		firstScreenMovingPlatformLocationsInSpace->getId());
-	firstScreenMovingPlatformServerClientPositionCommunications->addObject(movingPlatform5Id,
-		firstScreenMovingPlatformLocationsInSpace->getId());
-
-	/*make spawn point for character*/
-	spawnPointLocationsInSpace = new LocationInSpace(getNextId(), &propertyMap);
-	propertyMap.insert(std::pair<int, Property*>(spawnPointLocationsInSpace->getId(), spawnPointLocationsInSpace));
-	sf::CircleShape* spawnPoint1Shape = new sf::CircleShape(ClientServerConsts::CHARACTER_RADIUS, ClientServerConsts::CHARACTER_NUM_OF_POINTS);
-	spawnPoint1Id = getNextId();
-	spawnPoint1Shape->setPosition(50.f, 0.f);
-	spawnPointLocationsInSpace->addObject(spawnPoint1Id, spawnPoint1Shape);
-
-	/*make death zone*/
-	deathZoneLocationsInSpace = new LocationInSpace(getNextId(), &propertyMap);
-	propertyMap.insert(std::pair<int, Property*>(deathZoneLocationsInSpace->getId(), deathZoneLocationsInSpace));
-	deathZoneCollisions = new Collision(getNextId(), &propertyMap);
-	propertyMap.insert(std::pair<int, Property*>(deathZoneCollisions->getId(), deathZoneCollisions));
-	sf::RectangleShape* deathZone1Shape = new sf::RectangleShape(sf::Vector2f(1600.f, 600.f));
-	int deathZone1Id = getNextId();
-	deathZone1Shape->setPosition(-400.f, 650.f);
-	deathZoneLocationsInSpace->addObject(deathZone1Id, deathZone1Shape);
-	deathZoneCollisions->addObject(deathZone1Id, deathZoneLocationsInSpace->getId());
-
-	/* make character properties (LocationInSpace, Collision, Gravity, Respawning,
-	ServerClientPositionCommunication, PlayerDirectedMovement; no Rendering on server)*/
-	characterLocationsInSpace = new LocationInSpace(getNextId(), &propertyMap);
-	propertyMap.insert(std::pair<int, Property*>(characterLocationsInSpace->getId(), characterLocationsInSpace));
-	characterCollisions = new Collision(getNextId(), &propertyMap);
-	propertyMap.insert(std::pair<int, Property*>(characterCollisions->getId(), characterCollisions));
-	//only need id of rendering to send to client
-	characterRendering = getNextId();
-	characterServerClientPositionCommunications = new ServerClientPositionCommunication(getNextId(),
-		&propertyMap);
-	propertyMap.insert(std::pair<int, Property*>(characterServerClientPositionCommunications->getId(), 
-		characterServerClientPositionCommunications));
-	GameTimeline* characterTimeline = new GameTimeline(1.f, msTimeline);
-	characterPlayerDirectedMovements = new PlayerDirectedMovement(getNextId(), &propertyMap, characterTimeline);
-	propertyMap.insert(std::pair<int, Property*>(characterPlayerDirectedMovements->getId(), characterPlayerDirectedMovements));
-	characterGravity = new Gravity(getNextId(), &propertyMap, characterTimeline);
-	propertyMap.insert(std::pair<int, Property*>(characterGravity->getId(), characterGravity));
-	characterRespawning = new Respawning(getNextId(), &propertyMap);
-	propertyMap.insert(std::pair<int, Property*>(characterRespawning->getId(), characterRespawning));
-
-	//prepare event manager
-	eventManager = EventManager::getManager();
-	RealTimeline* msReplayTimeline = new RealTimeline(0.001f);
-	GameTimeline* replayTimeline = new GameTimeline(1.f, msReplayTimeline);
-	eventManager->setTimeline(msTimeline);
-	eventManager->setReplayTimeline(replayTimeline);
-	eventManager->setEventTypes({ ClientServerConsts::PLATFORM_MOVED_EVENT, ClientServerConsts::CHARACTER_JUMP_START_EVENT,
-		ClientServerConsts::CHARACTER_JUMP_END_EVENT, ClientServerConsts::CHARACTER_MOVED_EVENT,
-		ClientServerConsts::CHARACTER_STILL_JUMPING_EVENT,
-		ClientServerConsts::USER_INPUT_EVENT, ClientServerConsts::CHARACTER_MOVED_BY_GRAVITY_EVENT,
-		ClientServerConsts::CHARACTER_FALL_START_EVENT, ClientServerConsts::CHARACTER_STILL_FALLING_EVENT,
-		ClientServerConsts::CHARACTER_FALL_END_EVENT, ClientServerConsts::CHARACTER_COLLISION_EVENT,
-		ClientServerConsts::CHARACTER_DEATH_EVENT, ClientServerConsts::CHARACTER_SPAWN_EVENT,
-		ClientServerConsts::CHARACTER_MOVED_BY_PLATFORM_EVENT, ClientServerConsts::REPLAY_RECORDING_START_EVENT,
-		ClientServerConsts::REPLAY_RECORDING_STOP_EVENT});
-
-	//create handler for positional updates to client
-	PositionalUpdateHandler* positionalUpdateHandler = new PositionalUpdateHandler(&propertyMap, true, movementUpdatePubSubSocket);
-	eventManager->registerForEvent(ClientServerConsts::PLATFORM_MOVED_EVENT, positionalUpdateHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_EVENT, positionalUpdateHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_BY_GRAVITY_EVENT, positionalUpdateHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_SPAWN_EVENT, positionalUpdateHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_BY_PLATFORM_EVENT, positionalUpdateHandler);
-
-	//create handler for user inputs from client
-	UserInputHandler* userInputHandler = new UserInputHandler(&propertyMap, false, characterPlayerDirectedMovements->getId(),
-		characterLocationsInSpace->getId());
-	eventManager->registerForEvent(ClientServerConsts::USER_INPUT_EVENT, userInputHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_STILL_JUMPING_EVENT, userInputHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_FALL_START_EVENT, userInputHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_FALL_END_EVENT, userInputHandler);
-
-	//create handler for gravity
-	GravityHandler* gravityHandler = new GravityHandler(&propertyMap, false, characterGravity->getId(), characterLocationsInSpace->getId());
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_EVENT, gravityHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_STILL_FALLING_EVENT, gravityHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_JUMP_START_EVENT, gravityHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_JUMP_END_EVENT, gravityHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_SPAWN_EVENT, gravityHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_BY_PLATFORM_EVENT, gravityHandler);
-
-	//create handler for character collision
-	CharacterCollisionHandler* characterCollisionHandler = new CharacterCollisionHandler(&propertyMap, false, characterCollisions->getId(),
-		{ deathZoneCollisions->getId() });
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_EVENT, characterCollisionHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_BY_GRAVITY_EVENT, characterCollisionHandler);
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_BY_PLATFORM_EVENT, characterCollisionHandler);
-
-	//create handler for character death
-	CharacterDeathHandler* characterDeathHandler = new CharacterDeathHandler(&propertyMap, false, deathZoneCollisions->getId());
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_COLLISION_EVENT, characterDeathHandler);
-
-	//create handler for character spawn
-	CharacterSpawnHandler* characterSpawnHandler = new CharacterSpawnHandler(&propertyMap, false, characterLocationsInSpace->getId(),
-		characterRespawning->getId());
-	eventManager->registerForEvent(ClientServerConsts::CHARACTER_DEATH_EVENT, characterSpawnHandler);
-
-	//create handler for character being moved by platform
-	PlatformMovingCharacterHandler* platformMovingCharacterHandler = new PlatformMovingCharacterHandler(&propertyMap, false,
-		{ firstScreenMovingPlatformCollisions->getId() },
-		characterCollisions->getId(), characterGravity->getId(), characterLocationsInSpace->getId(),
-		{ firstScreenStaticPlatformCollisions->getId(), firstScreenMovingPlatformCollisions->getId() });
-	eventManager->registerForEvent(ClientServerConsts::PLATFORM_MOVED_EVENT, platformMovingCharacterHandler);
-
-	//create handler for managing replays
-	ReplayHandler* replayHandler = new ReplayHandler(&propertyMap, true, { ClientServerConsts::PLATFORM_MOVED_EVENT,
-		ClientServerConsts::CHARACTER_MOVED_EVENT, ClientServerConsts::CHARACTER_MOVED_BY_GRAVITY_EVENT,
-		ClientServerConsts::CHARACTER_MOVED_BY_PLATFORM_EVENT, ClientServerConsts::CHARACTER_SPAWN_EVENT });
-	eventManager->registerForEvent(ClientServerConsts::REPLAY_RECORDING_START_EVENT, replayHandler);
-	eventManager->registerForEvent(ClientServerConsts::REPLAY_RECORDING_STOP_EVENT, replayHandler);
-
-	/****MAIN LOOP START*****/
-	while (true)
-	{
-
-		/*CHECK FOR CONNECTIONS/DISCONNECTIONS*/
-		//process several updates
-		for (int i = 0; i < 5; i++)
-		{
-			//if client connected, create thread to handle their event requests and update port modifier
-			if (checkForConnectionUpdate())
-			{
-				std::thread* clientEventThread = new std::thread(handleClientEventRequests,
-					ClientServerConsts::EVENT_RAISING_REQ_REP_NUM_START + eventPortModifier);
-				eventPortModifier++;
-			}
-		}
-
-		//sleep for a bit
-		sleep(15);
-
-		/*UPDATE PLATFORM POSITIONS/POSSIBLY CHARACTERS STANDING ON THEM AND PUBLISH UPDATES ACCORDINGLY*/
-		if (!eventManager->isPlayingReplay())
-		{
-			//update moving platform positions
-			std::vector<int> movingPlatformIds = firstScreenMovingPlatformLocationsInSpace->getObjects();
-			int movingPlatformsNum = movingPlatformIds.size();
-			for (int i = 0; i < movingPlatformsNum; i++)
-			{
-				//record previous position
-				sf::Shape* movingPlatformShape = firstScreenMovingPlatformLocationsInSpace->getObjectShape(movingPlatformIds[i]);
-				float previousX = movingPlatformShape->getPosition().x;
-				float previousY = movingPlatformShape->getPosition().y;
-
-				//update position
-				firstScreenMovingPlatformRepeatedMovements->updatePosition(movingPlatformIds[i]);
-
-				//record new position
-				float newX = movingPlatformShape->getPosition().x;
-				float newY = movingPlatformShape->getPosition().y;
-
-				//create and raise event for platform movement
-				struct Event::ArgumentVariant objectIdArg = { Event::ArgumentType::TYPE_INTEGER, movingPlatformIds[i] };
-				struct Event::ArgumentVariant locationInSpaceIdArg = { Event::ArgumentType::TYPE_INTEGER,
-					firstScreenMovingPlatformLocationsInSpace->getId() };
-				struct Event::ArgumentVariant xArg;
-				xArg.argType = Event::ArgumentType::TYPE_FLOAT;
-				xArg.argValue.argAsFloat = newX - previousX;
-				struct Event::ArgumentVariant yArg;
-				yArg.argType = Event::ArgumentType::TYPE_FLOAT;
-				yArg.argValue.argAsFloat = newY - previousY;
-				struct Event::ArgumentVariant absoluteXArg;
-				absoluteXArg.argType = Event::ArgumentType::TYPE_FLOAT;
-				absoluteXArg.argValue.argAsFloat = newX;
-				struct Event::ArgumentVariant absoluteYArg;
-				absoluteYArg.argType = Event::ArgumentType::TYPE_FLOAT;
-				absoluteYArg.argValue.argAsFloat = newY;
-				//platform movements should be processed before anything already in queue (so that characters being moved by
-				//platform can be processed correctly)
-				Event* platformMovementEvent = new Event(eventManager->getCurrentTime() - 1000.f, ClientServerConsts::PLATFORM_MOVED_EVENT,
-					{ objectIdArg, locationInSpaceIdArg, xArg, yArg, absoluteXArg, absoluteYArg });
-
-				try
-				{
-					std::lock_guard<std::mutex> lock(queueLock);
-					eventManager->raise(platformMovementEvent);
-				}
-				catch (...)
-				{
-					std::cerr << "Error while raising platform move event" << std::endl;
-				}
-			}
-		}
-
-		//handle scheduled events
-		try
-		{
-			std::lock_guard<std::mutex> lock(queueLock);
-			eventManager->handleEvents();
-		}
-		catch (...)
-		{
-			std::cerr << "Error while handling events" << std::endl;
-		}
-		
-		//sleep for a bit
-		sleep(20);
-	}
-	/****MAIN LOOP END****/
-
-	/*DESTROY STATE*/
-	//delete sockets
-	delete(connectDisconnectReqRepSocket);
-	delete(connectDisconnectPubSubSocket);
-	delete(movementUpdatePubSubSocket);
-	delete(context);
-	//delete properties
-	while (propertyMap.size() > 0)
-	{
-		int currentPropertyId = propertyMap.begin()->first;
-		Property* currentProperty = propertyMap.begin()->second;
-		propertyMap.erase(currentPropertyId);
-		delete(currentProperty);
-	}
-	//delete static platform shapes
-	delete(platform1Shape);
-	delete(platform2Shape);
-	delete(platform3Shape);
-	delete(platform4Shape);
-	delete(platform5Shape);
-	//delete moving platform shapes
-	delete(movingPlatform1Shape);
-	delete(movingPlatform2Shape);
-	delete(movingPlatform3Shape);
-	delete(movingPlatform4Shape);
-	delete(movingPlatform5Shape);
-	return 0;
+#include <zmq.hpp>
+#include <stdlib.h>
+#include <string>
+#include <stdio.h>
+#include <iostream>
+#include <SFML/Graphics.hpp>
+#include <iostream>
+#include "Timeline.h"
+#include <thread>
+#include <chrono>
+#include <sstream>
+#include <random>
+#include "ClientServerConsts.h"
+#include "Property.h"
+#include "PropertyRegistry.h"
+#include "PropertyJoin.h"
+#include "EntityRegistry.h"
+#include "StructuralChangeBuffer.h"
+#include "LocationInSpace.h"
+#include "Collision.h"
+#include "Transform.h"
+#include "ObjectPool.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#else
+#include <windows.h>
+
+#define sleep(n)    Sleep(n)
+#endif
+#include "RepeatedMovement.h"
+#include "RealTimeline.h"
+#include "VirtualTimeline.h"
+#include "GameTimeline.h"
+#include "TimelineGraph.h"
+#include "ServerClientPositionCommunication.h"
+#include "Event.h"
+#include "EventHandler.h"
+#include "EventManager.h"
+#include "PositionalUpdateHandler.h"
+#include "PlayerDirectedMovement.h"
+#include "UserInputHandler.h"
+#include "Gravity.h"
+#include "GravityHandler.h"
+#include "Respawning.h"
+#include "CharacterCollisionHandler.h"
+#include "CharacterDeathHandler.h"
+#include "CharacterSpawnHandler.h"
+#include "PlatformMovingCharacterHandler.h"
+#include "ReplayHandler.h"
+#include "MovementCoalescingHandler.h"
+#include "TickScheduler.h"
+#include "Benchmarks.h"
+
+/* context for all sockets */
+zmq::context_t* context;
+
+/* socket used for receiving connection/disconnection requests from clients */
+zmq::socket_t* connectDisconnectReqRepSocket;
+
+/* socket used for sending connection/disconnection updates to all clients */
+zmq::socket_t* connectDisconnectPubSubSocket;
+
+/* socket used for sending movement updates to all clients */
+zmq::socket_t* movementUpdatePubSubSocket;
+
+/* socket used for sending object creation messages to connecting client */
+zmq::socket_t* objectCreationReqRepSocket;
+
+/* counter providing next property id to be assigned */
+int idCounter;
+
+/* registry of all properties */
+PropertyRegistry propertyRegistry;
+
+/* registry handing out ids (generational handles) for game objects */
+EntityRegistry entities;
+
+/* changes to which objects exist, held until the start of the next tick */
+StructuralChangeBuffer structuralChanges(&entities);
+
+/* transforms of every object in the world, kept together and reused as characters come and go */
+ObjectPool<Transform> transforms(64);
+
+/*character properties*/
+LocationInSpace* characterLocationsInSpace;
+Collision* characterCollisions;
+ServerClientPositionCommunication* characterServerClientPositionCommunications;
+PlayerDirectedMovement* characterPlayerDirectedMovements;
+Gravity* characterGravity;
+Respawning* characterRespawning;
+
+/*platform properties*/
+LocationInSpace* firstScreenStaticPlatformLocationsInSpace;
+LocationInSpace* firstScreenMovingPlatformLocationsInSpace;
+Collision* firstScreenStaticPlatformCollisions;
+Collision* firstScreenMovingPlatformCollisions;
+
+/* spawn point properties */
+LocationInSpace* spawnPointLocationsInSpace;
+
+/* death zone properties */
+LocationInSpace* deathZoneLocationsInSpace;
+Collision* deathZoneCollisions;
+
+/*ids of rendering properties for clients*/
+int firstScreenStaticPlatformRendering;
+int firstScreenMovingPlatformRendering;
+int characterRendering;
+
+/* manager for events */
+EventManager* eventManager;
+
+/* how often (in seconds) to print event system stats (0 to never print them) */
+const float EVENT_STATS_DUMP_INTERVAL = 30.f;
+
+/* number of server ticks per second */
+const float SERVER_TICK_RATE = 60.f;
+
+/* most ticks to run back to back when the server falls behind (any more are skipped) */
+const int MAX_CATCH_UP_TICKS = 5;
+
+/* default amount of virtual time (in seconds) and number of characters to simulate when running headless */
+const float DEFAULT_HEADLESS_SECONDS = 3600.f;
+const int DEFAULT_HEADLESS_CHARACTERS_NUM = 8;
+
+/* modifier for individual client event port numbers */
+int eventPortModifier;
+
+/* id of starting platform */
+int platform1Id;
+
+/* id of starting spawn point */
+int spawnPoint1Id;
+
+/*
+* Returns the next property id for assignment and then updates the counter. Game objects get their ids from entities instead.
+* 
+* returns: id to use for next assignment
+*/
+int getNextId()
+{
+	int nextId = idCounter;
+	idCounter++;
+	return nextId;
+}
+
+/*
+* Preps a message to be sent to the client for creating a particular property or object.
+* 
+* objectOrPropertyType: type of property or object being created
+* objectOrPropertyId: id of property or object being created
+* locationInSpacePropertyId: if object, id of corresponding locationInSpace property (filler if property)
+* renderingPropertyId: if object, id of corresponding rendering property (filler if property)
+* color: if object, color to give it (filler if property)
+* x: if object, x position (filler of property)
+* y: if object, y position (filler if property)
+* 
+* returns: pointer to message to send to client
+*/
+zmq::message_t* prepCreationMessage(int objectOrPropertyType, int objectOrPropertyId, int locationInSpacePropertyId,
+	int renderingPropertyId, int color, float x, float y)
+{
+	std::string replyString = std::to_string(objectOrPropertyType) + " " + std::to_string(objectOrPropertyId) + " "
+		+ std::to_string(locationInSpacePropertyId) + " " + std::to_string(renderingPropertyId) + " " +
+		std::to_string(color) + " " + std::to_string(x) + " " + std::to_string(y);
+	zmq::message_t* msg = new zmq::message_t(replyString.length() + 1);
+	const char* replyChars = replyString.c_str();
+	memcpy(msg->data(), replyChars, replyString.length() + 1);
+
+	return msg;
+}
+
+/*
+* Should be run in a separate thread for each client to allow checking for client event requests in parallel.
+*
+* eventPortNum: port number to use in creating socket
+*/
+void handleClientEventRequests(int eventPortNum)
+{
+	//std::cout << "Client thread starting" << std::endl;
+
+	//prepare and bind socket
+	zmq::socket_t eventRaisingReqRepSocket(*context, ZMQ_REP);
+	//std::cout << "Created thread socket" << std::endl;
+	
+	eventRaisingReqRepSocket.bind(ClientServerConsts::EVENT_RAISING_REQ_REP_SERVER_PORT_START + std::to_string(eventPortNum));
+	//std::cout << "Bound thread socket" << std::endl;
+
+	bool clientStillConnected = true;
+
+	while (clientStillConnected)
+	{
+		//sleep for a bit
+		sleep(5);
+
+		//see if there's a request from client, and if so handle it
+		try
+		{
+			zmq::message_t clientRequest;
+
+			if (eventRaisingReqRepSocket.recv(clientRequest, zmq::recv_flags::dontwait))
+			{
+				//determine event type
+				std::istringstream clientRequestStream(clientRequest.to_string());
+				int eventType = -1;
+				clientRequestStream >> eventType;
+
+				//retrieve payload (written by the client from the same schema)
+				EventSchemas::UserInput userInput;
+				if (eventType == ClientServerConsts::USER_INPUT_EVENT_CODE && !EventSchemas::read(clientRequestStream, userInput))
+				{
+					std::cerr << "Malformed user input request: " + clientRequest.to_string() << std::endl;
+				}
+				else if (eventType == ClientServerConsts::USER_INPUT_EVENT_CODE)
+				{
+					int keyType = userInput.keyType;
+
+					//if we are playing replay, only raise user input event if it is one of the three speed change keys
+					if (!EventManager::getManager()->isPlayingReplay()
+						|| (EventManager::getManager()->isPlayingReplay() && (keyType == ClientServerConsts::ONE_KEY ||
+							keyType == ClientServerConsts::TWO_KEY || keyType == ClientServerConsts::THREE_KEY)))
+					{
+						//queue event to be raised by the main loop on its next pass (timestamped then)
+						if (!EventManager::getManager()->queueEvent(ClientServerConsts::USER_INPUT_EVENT, userInput))
+						{
+							std::cerr << "Event queue full, dropping user input" << std::endl;
+						}
+					}
+				}
+				else if (eventType == ClientServerConsts::CLIENT_DISCONNECT_EVENT_CODE)
+				{
+					clientStillConnected = false;
+				}
+
+				//send back response
+				std::string replyString = "Event Received";
+				zmq::message_t* msg = new zmq::message_t(replyString.length() + 1);
+				const char* replyChars = replyString.c_str();
+				memcpy(msg->data(), replyChars, replyString.length() + 1);
+				eventRaisingReqRepSocket.send(*msg, zmq::send_flags::none);
+			}
+		}
+		catch (...)
+		{
+			std::cerr << "Error while checking for/handling client event request" << std::endl;
+		}
+	}
+
+	//std::cout << "Client thread ending" << std::endl;
+}
+
+/*
+* Creates the transform for a new character, at the starting spawn point.
+* 
+* returns: transform for new character
+*/
+Transform* createCharacterTransform()
+{
+	return transforms.acquire(50.f, 0.f, 2.f * ClientServerConsts::CHARACTER_RADIUS, 2.f * ClientServerConsts::CHARACTER_RADIUS,
+		sf::Color::Red.toInteger());
+}
+
+/*
+* Creates a new character at the starting spawn point. Its id is assigned right away, but it isn't added to the character
+* properties until structural changes are next applied.
+* 
+* characterTransform: transform to give the character (bounding box of the character's circle)
+* 
+* returns: id of new character
+*/
+int addCharacter(Transform* characterTransform)
+{
+	int charId = entities.create();
+
+	//queue adding character to properties
+	structuralChanges.queueAddition(charId, [charId, characterTransform]()
+	{
+		characterLocationsInSpace->addObject(charId, characterTransform);
+		characterCollisions->addObject(charId, characterLocationsInSpace->getId());
+		characterServerClientPositionCommunications->addObject(charId, characterLocationsInSpace->getId());
+		characterPlayerDirectedMovements->addObject(charId, characterLocationsInSpace->getId(), characterCollisions->getId(),
+			{ PlayerDirectedMovement::MovementOnInput(-1.f, 0.f, sf::Keyboard::Left, false),
+			PlayerDirectedMovement::MovementOnInput(1.f, 0.f, sf::Keyboard::Right, false),
+			PlayerDirectedMovement::MovementOnInput(0.f, -100.f, sf::Keyboard::Up, true) },
+			ClientServerConsts::CHARACTER_VELOCITY, true, { firstScreenStaticPlatformCollisions->getId(),
+			firstScreenMovingPlatformCollisions->getId() });
+		characterGravity->addObject(charId, characterLocationsInSpace->getId(), characterCollisions->getId(),
+			{ firstScreenStaticPlatformCollisions->getId(),
+			firstScreenMovingPlatformCollisions->getId() },
+			platform1Id, ClientServerConsts::CHARACTER_VELOCITY);
+		characterRespawning->addObject(charId, characterLocationsInSpace->getId(),
+			Respawning::SpawnPoint(spawnPoint1Id, spawnPointLocationsInSpace->getId()));
+	});
+
+	return charId;
+}
+
+/*
+* Checks for any connection/disconnection requests and processes them. Returns true if a connection was established to allow
+* adding a new thread to handle it.
+*/
+bool checkForConnectionUpdate()
+{
+	zmq::message_t connectDisconnectRequest;
+	if (connectDisconnectReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::dontwait))
+	{
+		//parse out request
+		int connectionObjectId = 0;
+		int scan = sscanf_s(connectDisconnectRequest.to_string().c_str(), "%d", &connectionObjectId);
+		//std::cout << "Received from client: " + std::to_string(connectionObjectId) << std::endl;
+
+		//if incorrect request, print error and send back error message
+		if (scan != 1)
+		{
+			std::cerr << "Error in communication while processing connection request" << std::endl;
+			std::string replyString = std::to_string(ClientServerConsts::CONNECT_ERROR_CODE) + " " + std::to_string(-1);
+			zmq::message_t replyMsg(replyString.length() + 1);
+			const char* replyChars = replyString.c_str();
+			memcpy(replyMsg.data(), replyChars, replyString.length() + 1);
+			connectDisconnectReqRepSocket->send(replyMsg, zmq::send_flags::none);
+			return false;
+		}
+		//if client is connecting, add character for them, send back message with character id
+		//and event port number, and publish connection update to all clients
+		else if (connectionObjectId == ClientServerConsts::CONNECT_CODE)
+		{
+			//create character
+			Transform* characterTransform = createCharacterTransform();
+			int charId = addCharacter(characterTransform);
+
+			//connections are handled between ticks, so apply the new character (and any other changes queued this pass) right
+			//away, so that the existing characters sent below include it and anyone who connected just before
+			structuralChanges.apply();
+
+			//send message with character id and event port number
+			int newEventPortNum = ClientServerConsts::EVENT_RAISING_REQ_REP_NUM_START + eventPortModifier;
+			std::string replyString = std::to_string(charId) + " " + std::to_string(newEventPortNum);
+			zmq::message_t replyMsg(replyString.length() + 1);
+			const char* replyChars = replyString.c_str();
+			memcpy(replyMsg.data(), replyChars, replyString.length() + 1);
+			connectDisconnectReqRepSocket->send(replyMsg, zmq::send_flags::none);
+
+			//send messages to client to create location in space properties
+			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
+			zmq::message_t* firstScreenStaticPlatformMsg = prepCreationMessage(ClientServerConsts::PROPERTY_LOCATION_IN_SPACE,
+				firstScreenStaticPlatformLocationsInSpace->getId(), ClientServerConsts::CREATION_FILLER, 
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
+			objectCreationReqRepSocket->send(*firstScreenStaticPlatformMsg, zmq::send_flags::none);
+			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
+			zmq::message_t* firstScreenMovingPlatformMsg = prepCreationMessage(ClientServerConsts::PROPERTY_LOCATION_IN_SPACE,
+				firstScreenMovingPlatformLocationsInSpace->getId(), ClientServerConsts::CREATION_FILLER,
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
+			objectCreationReqRepSocket->send(*firstScreenMovingPlatformMsg, zmq::send_flags::none);
+			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
+			zmq::message_t* existingCharsMsg = prepCreationMessage(ClientServerConsts::PROPERTY_LOCATION_IN_SPACE,
+				characterLocationsInSpace->getId(), ClientServerConsts::CREATION_FILLER,
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
+			objectCreationReqRepSocket->send(*existingCharsMsg, zmq::send_flags::none);
+
+			//send messages to client to create rendering properties
+			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
+			zmq::message_t* firstScreenStaticPlatformRenderingMsg = prepCreationMessage(ClientServerConsts::PROPERTY_RENDERING,
+				firstScreenStaticPlatformRendering, ClientServerConsts::CREATION_FILLER,
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
+			objectCreationReqRepSocket->send(*firstScreenStaticPlatformRenderingMsg, zmq::send_flags::none);
+			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
+			zmq::message_t* firstScreenMovingPlatformRenderingMsg = prepCreationMessage(ClientServerConsts::PROPERTY_RENDERING,
+				firstScreenMovingPlatformRendering, ClientServerConsts::CREATION_FILLER,
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
+			objectCreationReqRepSocket->send(*firstScreenMovingPlatformRenderingMsg, zmq::send_flags::none);
+			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
+			zmq::message_t* existingCharsRenderingMsg = prepCreationMessage(ClientServerConsts::PROPERTY_RENDERING,
+				characterRendering, ClientServerConsts::CREATION_FILLER,
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
+			objectCreationReqRepSocket->send(*existingCharsRenderingMsg, zmq::send_flags::none);
+
+			//send messages to client to create first screen static platforms
+			const std::vector<int>& firstScreenStaticPlatforms = firstScreenStaticPlatformLocationsInSpace->getObjects();
+			int firstScreenStaticPlatformsNum = firstScreenStaticPlatforms.size();
+			for (int i = 0; i < firstScreenStaticPlatformsNum; i++)
+			{
+				objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
+				Transform* staticPlatformTransform = firstScreenStaticPlatformLocationsInSpace->getObjectTransform(firstScreenStaticPlatforms[i]);
+				zmq::message_t* staticPlatformCreationMsg = prepCreationMessage(ClientServerConsts::STATIC_PLATFORM,
+					firstScreenStaticPlatforms[i], firstScreenStaticPlatformLocationsInSpace->getId(),
+					firstScreenStaticPlatformRendering, staticPlatformTransform->getColor(),
+					staticPlatformTransform->getX(), staticPlatformTransform->getY());
+				objectCreationReqRepSocket->send(*staticPlatformCreationMsg, zmq::send_flags::none);
+			}
+
+			//send messages to client to create first screen moving platforms
+			const std::vector<int>& firstScreenMovingPlatforms = firstScreenMovingPlatformLocationsInSpace->getObjects();
+			int firstScreenMovingPlatformsNum = firstScreenMovingPlatforms.size();
+			for (int i = 0; i < firstScreenMovingPlatformsNum; i++)
+			{
+				objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
+				Transform* movingPlatformTransform = firstScreenMovingPlatformLocationsInSpace->getObjectTransform(firstScreenMovingPlatforms[i]);
+				zmq::message_t* movingPlatformCreationMsg = prepCreationMessage(ClientServerConsts::MOVING_PLATFORM,
+					firstScreenMovingPlatforms[i], firstScreenMovingPlatformLocationsInSpace->getId(),
+					firstScreenMovingPlatformRendering, movingPlatformTransform->getColor(),
+					movingPlatformTransform->getX(), movingPlatformTransform->getY());
+				objectCreationReqRepSocket->send(*movingPlatformCreationMsg, zmq::send_flags::none);
+			}
+
+			//send messages to client to create existing characters
+			const std::vector<int>& existingChars = characterLocationsInSpace->getObjects();
+			int existingCharsNum = existingChars.size();
+			for (int i = 0; i < existingCharsNum; i++)
+			{
+				objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
+				Transform* charTransform = characterLocationsInSpace->getObjectTransform(existingChars[i]);
+				zmq::message_t* charCreationMsg = prepCreationMessage(ClientServerConsts::CHARACTER,
+					existingChars[i], characterLocationsInSpace->getId(),
+					characterRendering, charTransform->getColor(),
+					charTransform->getX(), charTransform->getY());
+				objectCreationReqRepSocket->send(*charCreationMsg, zmq::send_flags::none);
+			}
+
+			//send message to client indicating end of object/property creation
+			objectCreationReqRepSocket->recv(connectDisconnectRequest, zmq::recv_flags::none);
+			 zmq::message_t* endCreationMsg = prepCreationMessage(ClientServerConsts::CREATION_END, ClientServerConsts::CREATION_FILLER,
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER,
+				ClientServerConsts::CREATION_FILLER, ClientServerConsts::CREATION_FILLER);
+			objectCreationReqRepSocket->send(*endCreationMsg, zmq::send_flags::none);
+
+			//publish connection message to all clients so they can add new character
+			std::string connectMsgString = std::to_string(ClientServerConsts::CONNECT_CODE) + " " + std::to_string(charId) + " " 
+				+ std::to_string(characterLocationsInSpace->getId()) + " " + std::to_string(characterRendering)
+				+ " " + std::to_string(characterTransform->getX()) + " " + std::to_string(characterTransform->getY());
+			zmq::message_t connectMsg(connectMsgString.length() + 1);
+			const char* connectChars = connectMsgString.c_str();
+			memcpy(connectMsg.data(), connectChars, connectMsgString.length() + 1);
+			connectDisconnectPubSubSocket->send(connectMsg, zmq::send_flags::none);
+
+			return true;
+		}
+		//if client is disconnecting, queue removing character from all properties in which it exists, inform thread to stop
+		//running, send back message with success code, and publish disconnection update to all clients
+		else
+		{
+			//a character still waiting to be added has to be added before it can be removed like any other
+			if (structuralChanges.hasPendingAddition(connectionObjectId))
+			{
+				structuralChanges.apply();
+			}
+
+			//only characters can be disconnected (the id comes from the client, so it could name anything)
+			if (!characterLocationsInSpace->hasObject(connectionObjectId))
+			{
+				std::cerr << "Disconnection request for unknown character: " + std::to_string(connectionObjectId) << std::endl;
+				std::string replyString = std::to_string(ClientServerConsts::CONNECT_ERROR_CODE) + " " + std::to_string(-1);
+				zmq::message_t replyMsg(replyString.length() + 1);
+				const char* replyChars = replyString.c_str();
+				memcpy(replyMsg.data(), replyChars, replyString.length() + 1);
+				connectDisconnectReqRepSocket->send(replyMsg, zmq::send_flags::none);
+				return false;
+			}
+
+			structuralChanges.queueRemoval(characterLocationsInSpace, connectionObjectId);
+			structuralChanges.queueRemoval(characterCollisions, connectionObjectId);
+			structuralChanges.queueRemoval(characterServerClientPositionCommunications, connectionObjectId);
+			structuralChanges.queueRemoval(characterPlayerDirectedMovements, connectionObjectId);
+			structuralChanges.queueRemoval(characterGravity, connectionObjectId);
+			structuralChanges.queueRemoval(characterRespawning, connectionObjectId);
+
+			//return character's transform to the pool once nothing holds it
+			Transform* characterTransform = characterLocationsInSpace->getObjectTransform(connectionObjectId);
+			structuralChanges.queueRelease([characterTransform]() { transforms.release(characterTransform); });
+
+			//free character's id once it's removed, so that anything still holding it (such as events raised before the
+			//disconnect) sees it's gone
+			structuralChanges.queueDestruction(connectionObjectId);
+
+			//send message with disconnect success code
+			std::string replyString = std::to_string(ClientServerConsts::DISCONNECT_SUCCESS_CODE);
+			zmq::message_t replyMsg(replyString.length() + 1);
+			const char* replyChars = replyString.c_str();
+			memcpy(replyMsg.data(), replyChars, replyString.length() + 1);
+			connectDisconnectReqRepSocket->send(replyMsg, zmq::send_flags::none);
+
+			//publish disconnection update to all clients
+			std::string updateString = std::to_string(ClientServerConsts::DISCONNECT_CODE) + " " + std::to_string(connectionObjectId)
+				+ " " + std::to_string(characterLocationsInSpace->getId()) + " " + std::to_string(characterRendering)
+				+ " " + std::to_string(ClientServerConsts::CONNECTION_FILLER) + " " 
+				+ std::to_string(ClientServerConsts::CONNECTION_FILLER);
+			zmq::message_t updateMsg(updateString.length() + 1);
+			const char* updateChars = updateString.c_str();
+			memcpy(updateMsg.data(), updateChars, updateString.length() + 1);
+			connectDisconnectPubSubSocket->send(updateMsg, zmq::send_flags::none);
+
+			return false;
+		}
+	}
+
+	return false;
+}
+
+/*
+* Runs one server tick: moves the moving platforms (unless a replay is playing) and handles all events that are due. Time is
+* frozen for the length of the tick.
+* 
+* movingPlatformRepeatedMovements: RepeatedMovement property of the moving platforms
+* tickTime: clock reading the tick was due at, which time is frozen at
+*/
+void runTick(RepeatedMovement* movingPlatformRepeatedMovements, long long tickTime)
+{
+	//add and remove objects for any changes queued since the last tick, such as clients disconnecting (nothing changes which
+	//objects exist while the tick runs, so loops over a property's objects don't need to copy them first)
+	structuralChanges.apply();
+
+	//freeze time at the tick's deadline for the whole tick, so everything done in it sees the same time (and a tick run late
+	//to catch up still only moves things along by one tick period)
+	TimelineGraph::getGraph()->beginTick(tickTime);
+
+	//start tracking which objects move this tick
+	characterLocationsInSpace->beginTick();
+	firstScreenStaticPlatformLocationsInSpace->beginTick();
+	firstScreenMovingPlatformLocationsInSpace->beginTick();
+	spawnPointLocationsInSpace->beginTick();
+	deathZoneLocationsInSpace->beginTick();
+
+	/*UPDATE PLATFORM POSITIONS/POSSIBLY CHARACTERS STANDING ON THEM AND PUBLISH UPDATES ACCORDINGLY*/
+	if (!eventManager->isPlayingReplay())
+	{
+		//update moving platform positions (everything with a location in space and a repeated movement)
+		PropertyJoin<LocationInSpace, RepeatedMovement> movingPlatforms(firstScreenMovingPlatformLocationsInSpace,
+			movingPlatformRepeatedMovements);
+		for (PropertyJoin<LocationInSpace, RepeatedMovement>::Row& movingPlatform : movingPlatforms)
+		{
+			int movingPlatformId = movingPlatform.getId();
+
+			//record previous position
+			Transform* movingPlatformTransform = firstScreenMovingPlatformLocationsInSpace->getObjectTransformAt(
+				movingPlatform.getIndex<0>());
+			float previousX = movingPlatformTransform->getX();
+			float previousY = movingPlatformTransform->getY();
+
+			//update position
+			movingPlatformRepeatedMovements->updatePosition(movingPlatformId);
+
+			//a platform that didn't move (such as one paused at the end of its route) has nothing to send to clients or carry
+			//characters along with, so don't raise an event for it
+			if (!firstScreenMovingPlatformLocationsInSpace->hasMovedThisTickAt(movingPlatform.getIndex<0>()))
+			{
+				continue;
+			}
+
+			//record new position
+			float newX = movingPlatformTransform->getX();
+			float newY = movingPlatformTransform->getY();
+
+			//create and raise event for platform movement
+			EventSchemas::Movement movement = { movingPlatformId, firstScreenMovingPlatformLocationsInSpace->getId(),
+				newX - previousX, newY - previousY, newX, newY };
+			//platform movements should be processed before anything already in queue (so that characters being moved by
+			//platform can be processed correctly)
+			try
+			{
+				Event* platformMovementEvent = eventManager->createEvent(eventManager->getCurrentTime() - 1000.f,
+					ClientServerConsts::PLATFORM_MOVED_EVENT, movement);
+				eventManager->raise(platformMovementEvent);
+			}
+			catch (...)
+			{
+				std::cerr << "Error while raising platform move event" << std::endl;
+			}
+		}
+	}
+
+	//handle scheduled events
+	try
+	{
+		eventManager->handleEvents();
+	}
+	catch (...)
+	{
+		std::cerr << "Error while handling events" << std::endl;
+	}
+
+	TimelineGraph::getGraph()->endTick();
+}
+
+/*
+* Runs the simulation headless (without any clients) in virtual time as fast as it can go, with characters driven by scripted
+* random input, then reports how much faster than real time it ran along with the event system stats.
+* 
+* simulatedSeconds: amount of virtual time to simulate
+* charactersNum: number of characters to simulate
+* virtualTimelines: root timelines, which are advanced by one tick period before each tick
+* movingPlatformRepeatedMovements: RepeatedMovement property of the moving platforms
+* 
+* returns: exit code for the server
+*/
+int runHeadless(float simulatedSeconds, int charactersNum, std::vector<VirtualTimeline*> virtualTimelines,
+	RepeatedMovement* movingPlatformRepeatedMovements)
+{
+	std::vector<int> characterIds;
+	for (int i = 0; i < charactersNum; i++)
+	{
+		characterIds.push_back(addCharacter(createCharacterTransform()));
+	}
+
+	//same seed every run so that runs can be compared
+	std::mt19937 random(481);
+	float tickPeriod = 1.f / SERVER_TICK_RATE;
+	long long ticks = (long long)(simulatedSeconds * SERVER_TICK_RATE);
+	unsigned long long inputsNum = 0;
+	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+	for (long long tick = 0; tick < ticks; tick++)
+	{
+		int virtualTimelinesNum = virtualTimelines.size();
+		for (int i = 0; i < virtualTimelinesNum; i++)
+		{
+			virtualTimelines[i]->advance(tickPeriod);
+		}
+
+		//give each character the sort of input a player would (mostly walking, with the odd jump)
+		for (int i = 0; i < charactersNum; i++)
+		{
+			int roll = random() % 100;
+			int keyType = roll < 10 ? ClientServerConsts::LEFT_ARROW_KEY
+				: roll < 20 ? ClientServerConsts::RIGHT_ARROW_KEY
+				: roll < 22 ? ClientServerConsts::UP_ARROW_KEY : -1;
+			if (keyType != -1)
+			{
+				EventSchemas::UserInput userInput = { characterIds[i], keyType };
+				if (eventManager->queueEvent(ClientServerConsts::USER_INPUT_EVENT, userInput))
+				{
+					inputsNum++;
+				}
+			}
+		}
+
+		runTick(movingPlatformRepeatedMovements, Timeline::getClockSource()->readTicks());
+	}
+
+	float realSeconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+	std::cout << "Simulated " + std::to_string(simulatedSeconds) + " s (" + std::to_string(ticks) + " ticks) with "
+		+ std::to_string(charactersNum) + " characters and " + std::to_string(inputsNum) + " inputs in "
+		+ std::to_string(realSeconds) + " s" << std::endl;
+	if (realSeconds > 0.f)
+	{
+		std::cout << std::to_string(simulatedSeconds / realSeconds) + "x real time, " + std::to_string(ticks / realSeconds)
+			+ " ticks/s" << std::endl;
+	}
+	eventManager->dumpStats(std::cout);
+
+	return 0;
+}
+
+int main(int argc, char* argv[])
+{
+	//if asked to run headless, simulate for the given amount of virtual time (rather than serving clients in real time)
+	bool headless = argc > 1 && std::string(argv[1]) == "headless";
+	float headlessSeconds = headless && argc > 2 ? (float)atof(argv[2]) : DEFAULT_HEADLESS_SECONDS;
+	int headlessCharactersNum = headless && argc > 3 ? atoi(argv[3]) : DEFAULT_HEADLESS_CHARACTERS_NUM;
+
+	//if a benchmark was requested, run it instead of the server
+	if (argc > 1 && !headless)
+	{
+		return Benchmarks::run(argc, argv);
+	}
+
+	/*TODO: PREPARE STATE*/
+	//initialize property id counter and port modifier
+	idCounter = 0;
+	eventPortModifier = 0;
+
+	// Prepare our context and sockets
+	context = new zmq::context_t(1);
+	connectDisconnectReqRepSocket = new zmq::socket_t(*context, ZMQ_REP);
+	connectDisconnectPubSubSocket = new zmq::socket_t(*context, ZMQ_PUB);
+	movementUpdatePubSubSocket = new zmq::socket_t(*context, ZMQ_PUB);
+	objectCreationReqRepSocket = new zmq::socket_t(*context, ZMQ_REP);
+
+	//bind sockets (unless headless, in which case updates published on the unbound sockets are just dropped)
+	if (!headless)
+	{
+		connectDisconnectReqRepSocket->bind(ClientServerConsts::CONNECT_DISCONNECT_REQ_REP_SERVER_PORT);
+		connectDisconnectPubSubSocket->bind(ClientServerConsts::CONNECT_DISCONNECT_PUB_SUB_SERVER_PORT);
+		connectDisconnectPubSubSocket->set(zmq::sockopt::sndhwm, 10);
+		movementUpdatePubSubSocket->bind(ClientServerConsts::MOVEMENT_UPDATE_PUB_SUB_SERVER_PORT);
+		movementUpdatePubSubSocket->set(zmq::sockopt::sndhwm, 10);
+		objectCreationReqRepSocket->bind(ClientServerConsts::OBJECT_CREATION_REQ_REP_SERVER_PORT);
+	}
+
+	/* create static platform transforms for first "screen"*/
+	//starting platform
+	Transform* platform1Transform = transforms.acquire(50.f, 100.f,
+		ClientServerConsts::PLATFORM_WIDTH, ClientServerConsts::PLATFORM_HEIGHT, sf::Color::Green.toInteger());
+	platform1Id = entities.create();
+	//platform to right of starting one
+	Transform* platform2Transform = transforms.acquire(platform1Transform->getX() + ClientServerConsts::PLATFORM_WIDTH + 50.f,
+		platform1Transform->getY(), ClientServerConsts::PLATFORM_WIDTH, ClientServerConsts::PLATFORM_HEIGHT, sf::Color::Black.toInteger());
+	int platform2Id = entities.create();
+	//platform left of first "elevator"
+	Transform* platform3Transform = transforms.acquire(platform2Transform->getX() + 50.f, platform2Transform->getY() + 200.f,
+		ClientServerConsts::PLATFORM_WIDTH, ClientServerConsts::PLATFORM_HEIGHT, sf::Color::Yellow.toInteger());
+	int platform3Id = entities.create();
+	//platform at end of multidirectional platform route
+	Transform* platform4Transform = transforms.acquire(platform1Transform->getX() + 100.f, platform1Transform->getY() + 400.f,
+		ClientServerConsts::PLATFORM_WIDTH, ClientServerConsts::PLATFORM_HEIGHT, sf::Color::Green.toInteger());
+	int platform4Id = entities.create();
+	//platform to left of transitional platform
+	Transform* platform5Transform = transforms.acquire(platform4Transform->getX() + ClientServerConsts::PLATFORM_WIDTH + 200.f,
+		platform4Transform->getY(), ClientServerConsts::PLATFORM_WIDTH, ClientServerConsts::PLATFORM_HEIGHT, sf::Color::Black.toInteger());
+	int platform5Id = entities.create();
+
+	//create static platforms for first "screen" by defining their properties (LocationInSpace and Collision; no Rendering on server)
+	firstScreenStaticPlatformLocationsInSpace = new LocationInSpace(getNextId(), &propertyRegistry);
+	propertyRegistry.add(firstScreenStaticPlatformLocationsInSpace);
+	firstScreenStaticPlatformLocationsInSpace->addObject(platform1Id, platform1Transform);
+	firstScreenStaticPlatformLocationsInSpace->addObject(platform2Id, platform2Transform);
+	firstScreenStaticPlatformLocationsInSpace->addObject(platform3Id, platform3Transform);
+	firstScreenStaticPlatformLocationsInSpace->addObject(platform4Id, platform4Transform);
+	firstScreenStaticPlatformLocationsInSpace->addObject(platform5Id, platform5Transform);
+	firstScreenStaticPlatformCollisions = new Collision(getNextId(), &propertyRegistry);
+	propertyRegistry.add(firstScreenStaticPlatformCollisions);
+	firstScreenStaticPlatformCollisions->addObject(platform1Id, firstScreenStaticPlatformLocationsInSpace->getId());
+	firstScreenStaticPlatformCollisions->addObject(platform2Id, firstScreenStaticPlatformLocationsInSpace->getId());
+	firstScreenStaticPlatformCollisions->addObject(platform3Id, firstScreenStaticPlatformLocationsInSpace->getId());
+	firstScreenStaticPlatformCollisions->addObject(platform4Id, firstScreenStaticPlatformLocationsInSpace->getId());
+	firstScreenStaticPlatformCollisions->addObject(platform5Id, firstScreenStaticPlatformLocationsInSpace->getId());
+	//only need id of rendering to send to client
+	firstScreenStaticPlatformRendering = getNextId();
+
+	/*create moving platform transforms for first "screen"*/
+	//first "elevator" platform
+	Transform* movingPlatform1Transform = transforms.acquire(platform2Transform->getX() + ClientServerConsts::PLATFORM_WIDTH + 100.f,
+		platform2Transform->getY(), ClientServerConsts::PLATFORM_WIDTH, ClientServerConsts::PLATFORM_HEIGHT, sf::Color::White.toInteger());
+	int movingPlatform1Id = entities.create();
+	//multidirectional platform
+	Transform* movingPlatform2Transform = transforms.acquire(platform3Transform->getX() - ClientServerConsts::PLATFORM_WIDTH - 50.f,
+		platform3Transform->getY(), ClientServerConsts::PLATFORM_WIDTH, ClientServerConsts::PLATFORM_HEIGHT, sf::Color::White.toInteger());
+	int movingPlatform2Id = entities.create();
+	//second "elevator" platform
+	Transform* movingPlatform3Transform = transforms.acquire(platform4Transform->getX() + ClientServerConsts::PLATFORM_WIDTH + 50.f,
+		platform4Transform->getY(), ClientServerConsts::PLATFORM_WIDTH, ClientServerConsts::PLATFORM_HEIGHT, sf::Color::White.toInteger());
+	int movingPlatform3Id = entities.create();
+	//diagonally moving platform
+	Transform* movingPlatform4Transform = transforms.acquire(platform5Transform->getX() + 100.f,
+		platform5Transform->getY() + -ClientServerConsts::PLATFORM_HEIGHT - 60.f,
+		ClientServerConsts::PLATFORM_WIDTH, ClientServerConsts::PLATFORM_HEIGHT, sf::Color::White.toInteger());
+	int movingPlatform4Id = entities.create();
+	//transitional platform
+	Transform* movingPlatform5Transform = transforms.acquire(platform5Transform->getX() + ClientServerConsts::PLATFORM_WIDTH + 100.f,
+		platform5Transform->getY(), ClientServerConsts::PLATFORM_WIDTH, ClientServerConsts::PLATFORM_HEIGHT, sf::Color::White.toInteger());
+	int movingPlatform5Id = entities.create();
+
+	/*create moving platforms for first "screen" by defining their properties (LocationInSpace, Collision, RepeatedMovement,
+	* ServerClientPositionCommunication; no Rendering on server)
+	*/
+	firstScreenMovingPlatformLocationsInSpace = new LocationInSpace(getNextId(), &propertyRegistry);
+	propertyRegistry.add(firstScreenMovingPlatformLocationsInSpace);
+	firstScreenMovingPlatformLocationsInSpace->addObject(movingPlatform1Id, movingPlatform1Transform);
+	firstScreenMovingPlatformLocationsInSpace->addObject(movingPlatform2Id, movingPlatform2Transform);
+	firstScreenMovingPlatformLocationsInSpace->addObject(movingPlatform3Id, movingPlatform3Transform);
+	firstScreenMovingPlatformLocationsInSpace->addObject(movingPlatform4Id, movingPlatform4Transform);
+	firstScreenMovingPlatformLocationsInSpace->addObject(movingPlatform5Id, movingPlatform5Transform);
+	firstScreenMovingPlatformCollisions = new Collision(getNextId(), &propertyRegistry);
+	propertyRegistry.add(firstScreenMovingPlatformCollisions);
+	firstScreenMovingPlatformCollisions->addObject(movingPlatform1Id, firstScreenMovingPlatformLocationsInSpace->getId());
+	firstScreenMovingPlatformCollisions->addObject(movingPlatform2Id, firstScreenMovingPlatformLocationsInSpace->getId());
+	firstScreenMovingPlatformCollisions->addObject(movingPlatform3Id, firstScreenMovingPlatformLocationsInSpace->getId());
+	firstScreenMovingPlatformCollisions->addObject(movingPlatform4Id, firstScreenMovingPlatformLocationsInSpace->getId());
+	firstScreenMovingPlatformCollisions->addObject(movingPlatform5Id, firstScreenMovingPlatformLocationsInSpace->getId());
+	//only need id of rendering to send to client
+	firstScreenMovingPlatformRendering = getNextId();
+	//if headless, everything runs off virtual time instead of real time
+	VirtualTimeline* msVirtualTimeline = headless ? new VirtualTimeline(0.001f) : nullptr;
+	Timeline* msTimeline = headless ? (Timeline*)msVirtualTimeline : new RealTimeline(0.001f);
+	GameTimeline* movingPlatformTimeline = new GameTimeline(1.f, msTimeline);
+	RepeatedMovement* firstScreenMovingPlatformRepeatedMovements = new RepeatedMovement(getNextId(), &propertyRegistry, movingPlatformTimeline);
+	propertyRegistry.add(firstScreenMovingPlatformRepeatedMovements);
+	firstScreenMovingPlatformRepeatedMovements->addObject(movingPlatform1Id, firstScreenMovingPlatformLocationsInSpace->getId(),
+		{ RepeatedMovement::RepeatedMovementPosition(movingPlatform1Transform->getX(), movingPlatform1Transform->getY(), true),
+		RepeatedMovement::RepeatedMovementPosition(movingPlatform1Transform->getX(), movingPlatform1Transform->getY() + 100.f, true) },
+		ClientServerConsts::PLATFORM_PAUSE_DURATION, ClientServerConsts::PLATFORM_VELOCITY);
+	firstScreenMovingPlatformRepeatedMovements->addObject(movingPlatform2Id, firstScreenMovingPlatformLocationsInSpace->getId(),
+		{ RepeatedMovement::RepeatedMovementPosition(movingPlatform2Transform->getX(), movingPlatform2Transform->getY(), true),
+		RepeatedMovement::RepeatedMovementPosition(movingPlatform2Transform->getX() - 100.f, movingPlatform2Transform->getY(), false),
+		RepeatedMovement::RepeatedMovementPosition(movingPlatform2Transform->getX() - 100.f, movingPlatform2Transform->getY() + 100.f, true) },
+		ClientServerConsts::PLATFORM_PAUSE_DURATION, ClientServerConsts::PLATFORM_VELOCITY);
+	firstScreenMovingPlatformRepeatedMovements->addObject(movingPlatform3Id, firstScreenMovingPlatformLocationsInSpace->getId(),
+		{ RepeatedMovement::RepeatedMovementPosition(movingPlatform3Transform->getX(), movingPlatform3Transform->getY(), true),
+		RepeatedMovement::RepeatedMovementPosition(movingPlatform3Transform->getX(), movingPlatform3Transform->getY() - 50.f, true) },
+		ClientServerConsts::PLATFORM_PAUSE_DURATION, ClientServerConsts::PLATFORM_VELOCITY);
+	firstScreenMovingPlatformRepeatedMovements->addObject(movingPlatform4Id, firstScreenMovingPlatformLocationsInSpace->getId(),
+		{ RepeatedMovement::RepeatedMovementPosition(movingPlatform4Transform->getX(), movingPlatform4Transform->getY(), false),
+		RepeatedMovement::RepeatedMovementPosition(movingPlatform4Transform->getX() + 50.f, movingPlatform4Transform->getY() - 50.f, true) },
+		ClientServerConsts::PLATFORM_PAUSE_DURATION, ClientServerConsts::PLATFORM_VELOCITY);
+	firstScreenMovingPlatformRepeatedMovements->addObject(movingPlatform5Id, firstScreenMovingPlatformLocationsInSpace->getId(),
+		{ RepeatedMovement::RepeatedMovementPosition(movingPlatform5Transform->getX(), movingPlatform5Transform->getY(), true),
+		RepeatedMovement::RepeatedMovementPosition(movingPlatform5Transform->getX() + 200.f, movingPlatform5Transform->getY(), true) },
+		ClientServerConsts::PLATFORM_PAUSE_DURATION, ClientServerConsts::PLATFORM_VELOCITY);
+	ServerClientPositionCommunication* firstScreenMovingPlatformServerClientPositionCommunications =
+		new ServerClientPositionCommunication(getNextId(), &propertyRegistry);
+	propertyRegistry.add(firstScreenMovingPlatformServerClientPositionCommunications);
+	firstScreenMovingPlatformServerClientPositionCommunications->addObject(movingPlatform1Id,
+		firstScreenMovingPlatformLocationsInSpace->getId());
+	firstScreenMovingPlatformServerClientPositionCommunications->addObject(movingPlatform2Id,
+		firstScreenMovingPlatformLocationsInSpace->getId());
+	firstScreenMovingPlatformServerClientPositionCommunications->addObject(movingPlatform3Id,
+		firstScreenMovingPlatformLocationsInSpace->getId());
+	firstScreenMovingPlatformServerClientPositionCommunications->addObject(movingPlatform4Id,
+		firstScreenMovingPlatformLocationsInSpace->getId());
+	firstScreenMovingPlatformServerClientPositionCommunications->addObject(movingPlatform5Id,
+		firstScreenMovingPlatformLocationsInSpace->getId());
+
+	/*make spawn point for character*/
+	spawnPointLocationsInSpace = new LocationInSpace(getNextId(), &propertyRegistry);
+	propertyRegistry.add(spawnPointLocationsInSpace);
+	Transform* spawnPoint1Transform = transforms.acquire(50.f, 0.f, 2.f * ClientServerConsts::CHARACTER_RADIUS,
+		2.f * ClientServerConsts::CHARACTER_RADIUS, sf::Color::Transparent.toInteger());
+	spawnPoint1Id = entities.create();
+	spawnPointLocationsInSpace->addObject(spawnPoint1Id, spawnPoint1Transform);
+
+	/*make death zone*/
+	deathZoneLocationsInSpace = new LocationInSpace(getNextId(), &propertyRegistry);
+	propertyRegistry.add(deathZoneLocationsInSpace);
+	deathZoneCollisions = new Collision(getNextId(), &propertyRegistry);
+	propertyRegistry.add(deathZoneCollisions);
+	Transform* deathZone1Transform = transforms.acquire(-400.f, 650.f, 1600.f, 600.f, sf::Color::Transparent.toInteger());
+	int deathZone1Id = entities.create();
+	deathZoneLocationsInSpace->addObject(deathZone1Id, deathZone1Transform);
+	deathZoneCollisions->addObject(deathZone1Id, deathZoneLocationsInSpace->getId());
+
+	/* make character properties (LocationInSpace, Collision, Gravity, Respawning,
+	ServerClientPositionCommunication, PlayerDirectedMovement; no Rendering on server)*/
+	characterLocationsInSpace = new LocationInSpace(getNextId(), &propertyRegistry);
+	propertyRegistry.add(characterLocationsInSpace);
+	characterCollisions = new Collision(getNextId(), &propertyRegistry);
+	propertyRegistry.add(characterCollisions);
+	//only need id of rendering to send to client
+	characterRendering = getNextId();
+	characterServerClientPositionCommunications = new ServerClientPositionCommunication(getNextId(),
+		&propertyRegistry);
+	propertyRegistry.add(characterServerClientPositionCommunications);
+	GameTimeline* characterTimeline = new GameTimeline(1.f, msTimeline);
+	characterPlayerDirectedMovements = new PlayerDirectedMovement(getNextId(), &propertyRegistry, characterTimeline);
+	propertyRegistry.add(characterPlayerDirectedMovements);
+	characterGravity = new Gravity(getNextId(), &propertyRegistry, characterTimeline);
+	propertyRegistry.add(characterGravity);
+	characterRespawning = new Respawning(getNextId(), &propertyRegistry);
+	propertyRegistry.add(characterRespawning);
+
+	//prepare event manager
+	eventManager = EventManager::getManager();
+	VirtualTimeline* msVirtualReplayTimeline = headless ? new VirtualTimeline(0.001f) : nullptr;
+	Timeline* msReplayTimeline = headless ? (Timeline*)msVirtualReplayTimeline : new RealTimeline(0.001f);
+	GameTimeline* replayTimeline = new GameTimeline(1.f, msReplayTimeline);
+	eventManager->setTimeline(msTimeline);
+	eventManager->setReplayTimeline(replayTimeline);
+	eventManager->setStatsDumpInterval(EVENT_STATS_DUMP_INTERVAL);
+	eventManager->setEventTypes({ { ClientServerConsts::PLATFORM_MOVED_EVENT, ClientServerConsts::PLATFORM_MOVED_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_JUMP_START_EVENT, ClientServerConsts::CHARACTER_JUMP_START_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_JUMP_END_EVENT, ClientServerConsts::CHARACTER_JUMP_END_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_MOVED_EVENT, ClientServerConsts::CHARACTER_MOVED_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_STILL_JUMPING_EVENT, ClientServerConsts::CHARACTER_STILL_JUMPING_EVENT_NAME },
+		{ ClientServerConsts::USER_INPUT_EVENT, ClientServerConsts::USER_INPUT_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_MOVED_BY_GRAVITY_EVENT, ClientServerConsts::CHARACTER_MOVED_BY_GRAVITY_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_FALL_START_EVENT, ClientServerConsts::CHARACTER_FALL_START_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_STILL_FALLING_EVENT, ClientServerConsts::CHARACTER_STILL_FALLING_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_FALL_END_EVENT, ClientServerConsts::CHARACTER_FALL_END_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_COLLISION_EVENT, ClientServerConsts::CHARACTER_COLLISION_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_DEATH_EVENT, ClientServerConsts::CHARACTER_DEATH_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_SPAWN_EVENT, ClientServerConsts::CHARACTER_SPAWN_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_MOVED_BY_PLATFORM_EVENT, ClientServerConsts::CHARACTER_MOVED_BY_PLATFORM_EVENT_NAME },
+		{ ClientServerConsts::REPLAY_RECORDING_START_EVENT, ClientServerConsts::REPLAY_RECORDING_START_EVENT_NAME },
+		{ ClientServerConsts::REPLAY_RECORDING_STOP_EVENT, ClientServerConsts::REPLAY_RECORDING_STOP_EVENT_NAME },
+		{ ClientServerConsts::CHARACTER_NET_MOVED_EVENT, ClientServerConsts::CHARACTER_NET_MOVED_EVENT_NAME } });
+	eventManager->registerEventSchema<EventSchemas::NoArguments>();
+	eventManager->registerEventSchema<EventSchemas::UserInput>();
+	eventManager->registerEventSchema<EventSchemas::CharacterCollision>();
+	eventManager->registerEventSchema<EventSchemas::CharacterStateChange>();
+	eventManager->registerEventSchema<EventSchemas::CharacterSpawn>();
+	eventManager->registerEventSchema<EventSchemas::Movement>();
+	eventManager->registerEventSchema<EventSchemas::ReplayRecordingStop>();
+
+	//create handler for folding each character's movements in a pass into one net movement, so positional updates and collision
+	//checks only happen once per moved character per pass
+	MovementCoalescingHandler* movementCoalescingHandler = new MovementCoalescingHandler(&propertyRegistry, false);
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_EVENT, movementCoalescingHandler);
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_BY_GRAVITY_EVENT, movementCoalescingHandler);
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_BY_PLATFORM_EVENT, movementCoalescingHandler);
+	eventManager->registerForDispatchEnd(movementCoalescingHandler);
+	//only uses event arguments
+	movementCoalescingHandler->declarePropertyAccess({}, {});
+
+	//create handler for positional updates to client
+	PositionalUpdateHandler* positionalUpdateHandler = new PositionalUpdateHandler(&propertyRegistry, true, movementUpdatePubSubSocket);
+	eventManager->registerForEvent(ClientServerConsts::PLATFORM_MOVED_EVENT, positionalUpdateHandler);
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_NET_MOVED_EVENT, positionalUpdateHandler);
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_SPAWN_EVENT, positionalUpdateHandler);
+	//only uses event arguments and its own socket
+	positionalUpdateHandler->declarePropertyAccess({}, {});
+
+	//create handler for user inputs from client
+	UserInputHandler* userInputHandler = new UserInputHandler(&propertyRegistry, false, characterPlayerDirectedMovements->getId(),
+		characterLocationsInSpace->getId());
+	eventManager->registerForEvent(ClientServerConsts::USER_INPUT_EVENT, userInputHandler);
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_FALL_START_EVENT, userInputHandler);
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_FALL_END_EVENT, userInputHandler);
+	userInputHandler->declarePropertyAccess({ characterCollisions->getId(), firstScreenStaticPlatformCollisions->getId(),
+		firstScreenStaticPlatformLocationsInSpace->getId(), firstScreenMovingPlatformCollisions->getId(),
+		firstScreenMovingPlatformLocationsInSpace->getId() },
+		{ characterPlayerDirectedMovements->getId(), characterLocationsInSpace->getId() });
+
+	//create handler for gravity
+	GravityHandler* gravityHandler = new GravityHandler(&propertyRegistry, false, characterGravity->getId(), characterLocationsInSpace->getId());
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_EVENT, gravityHandler);
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_JUMP_START_EVENT, gravityHandler);
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_JUMP_END_EVENT, gravityHandler);
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_SPAWN_EVENT, gravityHandler);
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_MOVED_BY_PLATFORM_EVENT, gravityHandler);
+	gravityHandler->declarePropertyAccess({ characterCollisions->getId(), firstScreenStaticPlatformCollisions->getId(),
+		firstScreenStaticPlatformLocationsInSpace->getId(), firstScreenMovingPlatformCollisions->getId(),
+		firstScreenMovingPlatformLocationsInSpace->getId() },
+		{ characterGravity->getId(), characterLocationsInSpace->getId() });
+
+	//create handler for character collision
+	CharacterCollisionHandler* characterCollisionHandler = new CharacterCollisionHandler(&propertyRegistry, false, characterCollisions->getId(),
+		{ deathZoneCollisions->getId() });
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_NET_MOVED_EVENT, characterCollisionHandler);
+	characterCollisionHandler->declarePropertyAccess({ characterCollisions->getId(), characterLocationsInSpace->getId(),
+		deathZoneCollisions->getId(), deathZoneLocationsInSpace->getId() }, {});
+
+	//create handler for character death
+	CharacterDeathHandler* characterDeathHandler = new CharacterDeathHandler(&propertyRegistry, false, deathZoneCollisions->getId());
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_COLLISION_EVENT, characterDeathHandler);
+	characterDeathHandler->declarePropertyAccess({ deathZoneCollisions->getId() }, {});
+
+	//create handler for character spawn
+	CharacterSpawnHandler* characterSpawnHandler = new CharacterSpawnHandler(&propertyRegistry, false, characterLocationsInSpace->getId(),
+		characterRespawning->getId());
+	eventManager->registerForEvent(ClientServerConsts::CHARACTER_DEATH_EVENT, characterSpawnHandler);
+	characterSpawnHandler->declarePropertyAccess({ characterRespawning->getId(), spawnPointLocationsInSpace->getId() },
+		{ characterLocationsInSpace->getId() });
+
+	//create handler for character being moved by platform
+	PlatformMovingCharacterHandler* platformMovingCharacterHandler = new PlatformMovingCharacterHandler(&propertyRegistry, false,
+		{ firstScreenMovingPlatformCollisions->getId() },
+		characterCollisions->getId(), characterGravity->getId(), characterLocationsInSpace->getId(),
+		{ firstScreenStaticPlatformCollisions->getId(), firstScreenMovingPlatformCollisions->getId() });
+	eventManager->registerForEvent(ClientServerConsts::PLATFORM_MOVED_EVENT, platformMovingCharacterHandler);
+	platformMovingCharacterHandler->declarePropertyAccess({ characterCollisions->getId(), characterGravity->getId(),
+		firstScreenStaticPlatformCollisions->getId(), firstScreenStaticPlatformLocationsInSpace->getId(),
+		firstScreenMovingPlatformCollisions->getId(), firstScreenMovingPlatformLocationsInSpace->getId() },
+		{ characterLocationsInSpace->getId() });
+
+	//create handler for managing replays (it registers for events and starts replays while handling, so it doesn't declare its
+	//property accesses and always runs on its own)
+	ReplayHandler* replayHandler = new ReplayHandler(&propertyRegistry, true, { ClientServerConsts::PLATFORM_MOVED_EVENT,
+		ClientServerConsts::CHARACTER_NET_MOVED_EVENT, ClientServerConsts::CHARACTER_SPAWN_EVENT });
+	eventManager->registerForEvent(ClientServerConsts::REPLAY_RECORDING_START_EVENT, replayHandler);
+	eventManager->registerForEvent(ClientServerConsts::REPLAY_RECORDING_STOP_EVENT, replayHandler);
+
+	if (headless)
+	{
+		return runHeadless(headlessSeconds, headlessCharactersNum, { msVirtualTimeline, msVirtualReplayTimeline },
+			firstScreenMovingPlatformRepeatedMovements);
+	}
+
+	//schedule the loop in fixed ticks
+	TickScheduler tickScheduler(SERVER_TICK_RATE, MAX_CATCH_UP_TICKS, Timeline::getClockSource());
+
+	/****MAIN LOOP START*****/
+	while (true)
+	{
+		//wait for the next tick to be due (if we've fallen behind, several are due and are run back to back)
+		int ticksDue = tickScheduler.waitForTicks();
+
+		/*CHECK FOR CONNECTIONS/DISCONNECTIONS*/
+		//process several updates
+		for (int i = 0; i < 5; i++)
+		{
+			//if client connected, create thread to handle their event requests and update port modifier
+			if (checkForConnectionUpdate())
+			{
+				std::thread* clientEventThread = new std::thread(handleClientEventRequests,
+					ClientServerConsts::EVENT_RAISING_REQ_REP_NUM_START + eventPortModifier);
+				eventPortModifier++;
+			}
+		}
+
+		//run each tick that is due at the time it was due
+		for (int tick = 0; tick < ticksDue; tick++)
+		{
+			runTick(firstScreenMovingPlatformRepeatedMovements, tickScheduler.getDueTickTime(tick));
+		}
+	}
+	/****MAIN LOOP END****/
+
+	/*DESTROY STATE*/
+	//delete sockets
+	delete(connectDisconnectReqRepSocket);
+	delete(connectDisconnectPubSubSocket);
+	delete(movementUpdatePubSubSocket);
+	delete(context);
+	//delete properties
+	propertyRegistry.deleteAll();
+	//release every object's transform
+	transforms.releaseAll();
+	return 0;
 }
\ No newline at end of file